@@ -9,24 +9,60 @@ TEMPLATE = app
 INCLUDEPATH += src/
 
 SOURCES += \
+    src/core/procfilereader.cpp \
+    src/core/procreadbatch.cpp \
+    src/core/procparser.cpp \
+    src/core/cpukernels.cpp \
+    src/core/cpufrequencysampler.cpp \
+    src/core/thermalsampler.cpp \
+    src/core/systeminfocache.cpp \
+    src/core/sampleclock.cpp \
+    src/core/latencyhistogram.cpp \
+    src/core/sourcewatchdog.cpp \
+    src/core/proceventlistener.cpp \
     src/core/systemutils.cpp \
     src/model/base/basemonitor.cpp \
+    src/model/base/samplingscheduler.cpp \
+    src/model/base/coalescingmailbox.cpp \
     src/model/managers/alertmanager.cpp \
     src/model/managers/datamanager.cpp \
     src/model/monitors/cpumonitor.cpp \
     src/model/monitors/memorymonitor.cpp \
+    src/model/monitors/networkmonitor.cpp \
+    src/model/monitors/storagemonitor.cpp \
+    src/model/monitors/systemloadmonitor.cpp \
+    src/model/monitors/processmonitor.cpp \
     src/view/widgets/circularprogress.cpp \
     src/view/widgets/metriccard.cpp
 
 HEADERS += \
     src/core/constants.h \
     src/core/types.h \
+    src/core/procfilereader.h \
+    src/core/procreadbatch.h \
+    src/core/procparser.h \
+    src/core/cpukernels.h \
+    src/core/cpufrequencysampler.h \
+    src/core/thermalsampler.h \
+    src/core/systeminfocache.h \
+    src/core/sampleclock.h \
+    src/core/snapshotbuffer.h \
+    src/core/pidmap.h \
+    src/core/latencyhistogram.h \
+    src/core/sourcewatchdog.h \
+    src/core/proceventlistener.h \
     src/core/systemutils.h \
     src/model/base/basemonitor.h \
+    src/model/base/samplingscheduler.h \
+    src/model/base/coalescingmailbox.h \
     src/model/managers/alertmanager.h \
     src/model/managers/datamanager.h \
     src/model/monitors/cpumonitor.h \
     src/model/monitors/memorymonitor.h \
+    src/model/monitors/networkmonitor.h \
+    src/model/monitors/storagemonitor.h \
+    src/model/monitors/systemloadmonitor.h \
+    src/model/monitors/processmonitor.h \
     src/view/widgets/circularprogress.h \
     src/view/widgets/metriccard.h
 
@@ -37,11 +73,50 @@ CONFIG(test) {
     SOURCES += \
         tests/test_main.cpp \
         tests/unit/test_systemutils.cpp \
-        tests/unit/test_cpumonitor.cpp
+        tests/unit/test_procparser.cpp \
+        tests/unit/test_cpukernels.cpp \
+        tests/unit/test_systeminfocache.cpp \
+        tests/unit/test_procreadbatch.cpp \
+        tests/unit/test_sampleclock.cpp \
+        tests/unit/test_snapshotbuffer.cpp \
+        tests/unit/test_latencyhistogram.cpp \
+        tests/unit/test_sourcewatchdog.cpp \
+        tests/unit/test_thermalsampler.cpp \
+        tests/unit/test_cpufrequencysampler.cpp \
+        tests/unit/test_basemonitor.cpp \
+        tests/unit/test_coalescingmailbox.cpp \
+        tests/unit/test_cpumonitor.cpp \
+        tests/unit/test_networkmonitor.cpp \
+        tests/unit/test_storagemonitor.cpp \
+        tests/unit/test_systemloadmonitor.cpp \
+        tests/unit/test_processmonitor.cpp \
+        tests/unit/test_pidmap.cpp \
+        tests/unit/test_proceventlistener.cpp \
+        tests/unit/test_samplingscheduler.cpp
 
     HEADERS += \
+        tests/unit/testhelpers.h \
         tests/unit/test_systemutils.h \
-        tests/unit/test_cpumonitor.h
+        tests/unit/test_procparser.h \
+        tests/unit/test_cpukernels.h \
+        tests/unit/test_systeminfocache.h \
+        tests/unit/test_procreadbatch.h \
+        tests/unit/test_sampleclock.h \
+        tests/unit/test_snapshotbuffer.h \
+        tests/unit/test_latencyhistogram.h \
+        tests/unit/test_sourcewatchdog.h \
+        tests/unit/test_thermalsampler.h \
+        tests/unit/test_cpufrequencysampler.h \
+        tests/unit/test_basemonitor.h \
+        tests/unit/test_coalescingmailbox.h \
+        tests/unit/test_cpumonitor.h \
+        tests/unit/test_networkmonitor.h \
+        tests/unit/test_storagemonitor.h \
+        tests/unit/test_systemloadmonitor.h \
+        tests/unit/test_processmonitor.h \
+        tests/unit/test_pidmap.h \
+        tests/unit/test_proceventlistener.h \
+        tests/unit/test_samplingscheduler.h
 
 } else {
     # Main application
@@ -25,14 +25,25 @@ const int UPDATE_INTERVAL = 1000;              // 1s - CPU, RAM, Temperature
 const int FAST_UPDATE_INTERVAL = 500;          // 0.5s - UI animations only
 const int SLOW_UPDATE_INTERVAL = 5000;         // 5s - Storage, System info
 const int NETWORK_UPDATE_INTERVAL = 2000;      // 2s - Network stats
+const int DISK_UPDATE_INTERVAL = 2000;         // 2s - Disk I/O rates
+const int PROCESS_UPDATE_INTERVAL = 1000;      // 1s - Process table scan
+const int PROCESS_RECONCILE_INTERVAL = 30000;  // 30s - Full /proc listing with process events
 const int ALERT_CHECK_INTERVAL = 3000;         // 3s - Alert checking
 const int ALERT_CLEANUP_INTERVAL = 300000;     // 5 minutes - Alert cleanup
+const int SCHEDULER_BASE_TICK = 100;           // 0.1s - Sampling scheduler granularity
+const int MIN_UPDATE_INTERVAL = 100;           // 0.1s - Fastest (adaptive) sampling
+const int MAX_UPDATE_INTERVAL = 10000;         // 10s - Slowest (adaptive) sampling
+const int LATENCY_DUMP_INTERVAL = 0;           // Tick latency debug dump, off until set
+const int SOURCE_READ_TIMEOUT = 250;           // 0.25s - Deadline for one data source read
+const int SOURCE_RETRY_MIN = 1000;             // 1s - First retry of a hung source
+const int SOURCE_RETRY_MAX = 60000;            // 60s - Retry backoff cap
 
 // ===================================================================
 // MEMORY CONSTRAINTS (Pi 3B+ - 1GB RAM)
 // ===================================================================
 const int MAX_HISTORY_SIZE = 120;              // 2 minutes at 1Hz (120 points)
 const int MAX_ALERTS_HISTORY = 200;            // Maximum stored alerts
+const int PROCESS_TOP_COUNT = 10;              // Processes kept per top list
 const int MAX_APPLICATION_MEMORY_MB = 50;      // <50MB total app usage
 
 // ===================================================================
@@ -47,6 +58,7 @@ const double TEMP_CRITICAL_THRESHOLD = 80.0;   // 80°C temperature critical
 const double STORAGE_WARNING_THRESHOLD = 85.0; // 85% storage warning
 const double STORAGE_CRITICAL_THRESHOLD = 95.0;// 95% storage critical
 const double NETWORK_WARNING_THRESHOLD = 50.0; // 50 MB/s network warning
+const double DISK_BUSY_WARNING_THRESHOLD = 90.0;// 90% disk utilization warning
 
 // ===================================================================
 // UI DIMENSIONS (ILI9341 320x240 Display)
@@ -68,10 +80,16 @@ const QString PROC_CPUINFO = "/proc/cpuinfo";
 const QString PROC_VERSION = "/proc/version";
 const QString PROC_NET_DEV = "/proc/net/dev";
 const QString PROC_MOUNTS = "/proc/mounts";
+const QString PROC_DISKSTATS = "/proc/diskstats";
 const QString PROC_UPTIME = "/proc/uptime";
+const QString PROC_PATH = "/proc";
 const QString PROC_LOADAVG = "/proc/loadavg";
 const QString THERMAL_ZONE_PATH = "/sys/class/thermal/thermal_zone0/temp";
 const QString CPUFREQ_PATH = "/sys/devices/system/cpu/cpu0/cpufreq/scaling_cur_freq";
+const QString CPU_SYSFS_PATH = "/sys/devices/system/cpu";
+const QString THERMAL_CLASS_PATH = "/sys/class/thermal";
+const QString HWMON_CLASS_PATH = "/sys/class/hwmon";
+const QString BLOCK_CLASS_PATH = "/sys/class/block";
 
 // ===================================================================
 // COLOR SCHEME (Professional Dark Theme)
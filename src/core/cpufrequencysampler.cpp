@@ -0,0 +1,80 @@
+/**
+ * @file cpufrequencysampler.cpp
+ * @brief Batched per-core cpufreq sampler implementation
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#include "cpufrequencysampler.h"
+
+#include <unistd.h>
+
+CPUFrequencySampler::CPUFrequencySampler()
+    : m_averageFrequency(0.0)
+    , m_availableCount(0)
+{
+}
+
+int CPUFrequencySampler::discover(int coreCount, const QString &cpuRoot)
+{
+    m_readers.clear();
+    m_readers.resize(static_cast<size_t>(qMax(0, coreCount)));
+    m_frequencies.fill(0.0, qMax(0, coreCount));
+    m_averageFrequency = 0.0;
+    m_availableCount = 0;
+
+    int found = 0;
+    for (int i = 0; i < coreCount; ++i) {
+        const QString path = QString("%1/cpu%2/cpufreq/scaling_cur_freq").arg(cpuRoot).arg(i);
+
+        // Missing cpufreq directory: leave the slot empty, no warning spam
+        if (::access(path.toLocal8Bit().constData(), R_OK) != 0) {
+            continue;
+        }
+
+        auto reader = std::make_unique<ProcFileReader>(path, 64);
+        if (reader->open()) {
+            m_readers[static_cast<size_t>(i)] = std::move(reader);
+            ++found;
+        }
+    }
+
+    return found;
+}
+
+int CPUFrequencySampler::sample()
+{
+    for (const auto& reader : m_readers) {
+        if (reader) reader->read();
+    }
+    return update();
+}
+
+void CPUFrequencySampler::addReaders(ProcReadBatch &batch)
+{
+    for (const auto& reader : m_readers) {
+        if (reader) batch.addReader(reader.get());
+    }
+}
+
+int CPUFrequencySampler::update()
+{
+    double sum = 0.0;
+    int valid = 0;
+
+    for (size_t i = 0; i < m_readers.size(); ++i) {
+        double frequency = 0.0;
+        qint64 freqKHz = 0;
+        if (m_readers[i] && m_readers[i]->toInt64(&freqKHz) && freqKHz > 0) {
+            // Convert kHz to MHz
+            frequency = freqKHz / 1000.0;
+            sum += frequency;
+            ++valid;
+        }
+        m_frequencies[static_cast<int>(i)] = frequency;
+    }
+
+    m_availableCount = valid;
+    m_averageFrequency = (valid > 0) ? sum / valid : 0.0;
+    return valid;
+}
@@ -0,0 +1,68 @@
+/**
+ * @file cpufrequencysampler.h
+ * @brief Batched per-core cpufreq sampler
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#ifndef CPUFREQUENCYSAMPLER_H
+#define CPUFREQUENCYSAMPLER_H
+
+#include <QVector>
+#include <memory>
+#include <vector>
+#include "constants.h"
+#include "procfilereader.h"
+#include "procreadbatch.h"
+
+/**
+ * @brief Reads scaling_cur_freq of every present CPU each tick
+ *
+ * Descriptors are opened once by discover(). CPUs without a cpufreq
+ * directory (VMs, fixed-clock boards, offline cores) report 0 MHz and
+ * are left out of the average.
+ */
+class CPUFrequencySampler
+{
+public:
+    CPUFrequencySampler();
+
+    /**
+     * @brief Open scaling_cur_freq for cpu0..cpu(coreCount-1)
+     * @param coreCount Number of CPUs to sample
+     * @param cpuRoot CPU sysfs directory
+     * @return Number of CPUs with a cpufreq interface
+     */
+    int discover(int coreCount, const QString& cpuRoot = CPU_SYSFS_PATH);
+
+    /**
+     * @brief Read every open descriptor, then update()
+     * @return Number of CPUs with a valid reading
+     */
+    int sample();
+
+    /**
+     * @brief Register the open descriptors with a per-tick batch
+     * Call update() after the batch's readAll() instead of sample().
+     */
+    void addReaders(ProcReadBatch& batch);
+
+    /**
+     * @brief Recompute the results from the readers' last content
+     * @return Number of CPUs with a valid reading
+     */
+    int update();
+
+    // Results of the last sample (MHz)
+    const QVector<double>& frequencies() const { return m_frequencies; }
+    double averageFrequency() const { return m_averageFrequency; }
+    int availableCount() const { return m_availableCount; }
+
+private:
+    std::vector<std::unique_ptr<ProcFileReader>> m_readers;
+    QVector<double> m_frequencies;
+    double m_averageFrequency;
+    int m_availableCount;
+};
+
+#endif // CPUFREQUENCYSAMPLER_H
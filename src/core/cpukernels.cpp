@@ -0,0 +1,298 @@
+/**
+ * @file cpukernels.cpp
+ * @brief Vectorized per-core CPU delta kernels implementation
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#include "cpukernels.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define CPUKERNELS_HAVE_SSE2 1
+#endif
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define CPUKERNELS_HAVE_AVX2 1
+#endif
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#define CPUKERNELS_HAVE_NEON 1
+#endif
+
+namespace {
+
+const int FIELD_COUNT = CPUStatArrays::FieldCount;
+const int IDLE = CPUStatArrays::Idle;
+
+struct KernelArgs {
+    const quint64* current[FIELD_COUNT];
+    const quint64* previous[FIELD_COUNT];
+    double* percent[FIELD_COUNT];
+    double* usage;
+    int stride;
+};
+
+// ===================================================================
+// SCALAR
+// ===================================================================
+
+void deltasScalar(const KernelArgs& args)
+{
+    for (int i = 0; i < args.stride; ++i) {
+        double delta[FIELD_COUNT];
+        double total = 0.0;
+        for (int f = 0; f < FIELD_COUNT; ++f) {
+            const double d = static_cast<double>(args.current[f][i]) -
+                             static_cast<double>(args.previous[f][i]);
+            delta[f] = d > 0.0 ? d : 0.0;
+            total += delta[f];
+        }
+
+        const double scale = total > 0.0 ? 100.0 / total : 0.0;
+        for (int f = 0; f < FIELD_COUNT; ++f) {
+            args.percent[f][i] = delta[f] * scale;
+        }
+
+        double busy = total > 0.0 ? 100.0 - args.percent[IDLE][i] : 0.0;
+        busy = busy < 0.0 ? 0.0 : busy;
+        args.usage[i] = busy > 100.0 ? 100.0 : busy;
+    }
+}
+
+// ===================================================================
+// SSE2 (2 cores per step)
+// ===================================================================
+
+#if defined(CPUKERNELS_HAVE_SSE2)
+inline __m128d toDoubleSSE2(__m128i value)
+{
+    // uint64 < 2^52 -> double: splice into the mantissa of 2^52
+    const __m128i magicBits = _mm_set1_epi64x(0x4330000000000000LL);
+    const __m128d magic = _mm_set1_pd(4503599627370496.0);
+    return _mm_sub_pd(_mm_castsi128_pd(_mm_or_si128(value, magicBits)), magic);
+}
+
+void deltasSSE2(const KernelArgs& args)
+{
+    const __m128d zero = _mm_setzero_pd();
+    const __m128d hundred = _mm_set1_pd(100.0);
+
+    for (int i = 0; i < args.stride; i += 2) {
+        __m128d delta[FIELD_COUNT];
+        __m128d total = zero;
+        for (int f = 0; f < FIELD_COUNT; ++f) {
+            const __m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i*>(args.current[f] + i));
+            const __m128i previous = _mm_loadu_si128(reinterpret_cast<const __m128i*>(args.previous[f] + i));
+            delta[f] = _mm_max_pd(_mm_sub_pd(toDoubleSSE2(current), toDoubleSSE2(previous)), zero);
+            total = _mm_add_pd(total, delta[f]);
+        }
+
+        const __m128d valid = _mm_cmpgt_pd(total, zero);
+        const __m128d scale = _mm_and_pd(valid, _mm_div_pd(hundred, total));
+        for (int f = 0; f < FIELD_COUNT; ++f) {
+            _mm_storeu_pd(args.percent[f] + i, _mm_mul_pd(delta[f], scale));
+        }
+
+        const __m128d idle = _mm_mul_pd(delta[IDLE], scale);
+        __m128d busy = _mm_and_pd(valid, _mm_sub_pd(hundred, idle));
+        busy = _mm_min_pd(_mm_max_pd(busy, zero), hundred);
+        _mm_storeu_pd(args.usage + i, busy);
+    }
+}
+#endif
+
+// ===================================================================
+// AVX2 (4 cores per step, runtime dispatched)
+// ===================================================================
+
+#if defined(CPUKERNELS_HAVE_AVX2)
+__attribute__((target("avx2")))
+inline __m256d toDoubleAVX2(__m256i value)
+{
+    const __m256i magicBits = _mm256_set1_epi64x(0x4330000000000000LL);
+    const __m256d magic = _mm256_set1_pd(4503599627370496.0);
+    return _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(value, magicBits)), magic);
+}
+
+__attribute__((target("avx2")))
+void deltasAVX2(const KernelArgs& args)
+{
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d hundred = _mm256_set1_pd(100.0);
+
+    for (int i = 0; i < args.stride; i += 4) {
+        __m256d delta[FIELD_COUNT];
+        __m256d total = zero;
+        for (int f = 0; f < FIELD_COUNT; ++f) {
+            const __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(args.current[f] + i));
+            const __m256i previous = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(args.previous[f] + i));
+            delta[f] = _mm256_max_pd(_mm256_sub_pd(toDoubleAVX2(current), toDoubleAVX2(previous)), zero);
+            total = _mm256_add_pd(total, delta[f]);
+        }
+
+        const __m256d valid = _mm256_cmp_pd(total, zero, _CMP_GT_OQ);
+        const __m256d scale = _mm256_and_pd(valid, _mm256_div_pd(hundred, total));
+        for (int f = 0; f < FIELD_COUNT; ++f) {
+            _mm256_storeu_pd(args.percent[f] + i, _mm256_mul_pd(delta[f], scale));
+        }
+
+        const __m256d idle = _mm256_mul_pd(delta[IDLE], scale);
+        __m256d busy = _mm256_and_pd(valid, _mm256_sub_pd(hundred, idle));
+        busy = _mm256_min_pd(_mm256_max_pd(busy, zero), hundred);
+        _mm256_storeu_pd(args.usage + i, busy);
+    }
+}
+#endif
+
+// ===================================================================
+// NEON (AArch64 only, 2 cores per step)
+// ===================================================================
+
+#if defined(CPUKERNELS_HAVE_NEON)
+void deltasNEON(const KernelArgs& args)
+{
+    const float64x2_t zero = vdupq_n_f64(0.0);
+    const float64x2_t hundred = vdupq_n_f64(100.0);
+
+    for (int i = 0; i < args.stride; i += 2) {
+        float64x2_t delta[FIELD_COUNT];
+        float64x2_t total = zero;
+        for (int f = 0; f < FIELD_COUNT; ++f) {
+            const float64x2_t current = vcvtq_f64_u64(vld1q_u64(args.current[f] + i));
+            const float64x2_t previous = vcvtq_f64_u64(vld1q_u64(args.previous[f] + i));
+            delta[f] = vmaxq_f64(vsubq_f64(current, previous), zero);
+            total = vaddq_f64(total, delta[f]);
+        }
+
+        const uint64x2_t valid = vcgtq_f64(total, zero);
+        const float64x2_t scale = vreinterpretq_f64_u64(
+            vandq_u64(valid, vreinterpretq_u64_f64(vdivq_f64(hundred, total))));
+        for (int f = 0; f < FIELD_COUNT; ++f) {
+            vst1q_f64(args.percent[f] + i, vmulq_f64(delta[f], scale));
+        }
+
+        const float64x2_t idle = vmulq_f64(delta[IDLE], scale);
+        float64x2_t busy = vreinterpretq_f64_u64(
+            vandq_u64(valid, vreinterpretq_u64_f64(vsubq_f64(hundred, idle))));
+        busy = vminq_f64(vmaxq_f64(busy, zero), hundred);
+        vst1q_f64(args.usage + i, busy);
+    }
+}
+#endif
+
+CPUKernels::Backend detectBackend()
+{
+#if defined(CPUKERNELS_HAVE_AVX2)
+    if (__builtin_cpu_supports("avx2")) {
+        return CPUKernels::Backend::AVX2;
+    }
+#endif
+#if defined(CPUKERNELS_HAVE_SSE2)
+    return CPUKernels::Backend::SSE2;
+#elif defined(CPUKERNELS_HAVE_NEON)
+    return CPUKernels::Backend::NEON;
+#else
+    return CPUKernels::Backend::Scalar;
+#endif
+}
+
+} // namespace
+
+CPUKernels::Backend CPUKernels::activeBackend()
+{
+    static const Backend backend = detectBackend();
+    return backend;
+}
+
+bool CPUKernels::isSupported(Backend backend)
+{
+    switch (backend) {
+    case Backend::Scalar:
+        return true;
+    case Backend::SSE2:
+#if defined(CPUKERNELS_HAVE_SSE2)
+        return true;
+#else
+        return false;
+#endif
+    case Backend::AVX2:
+#if defined(CPUKERNELS_HAVE_AVX2)
+        return __builtin_cpu_supports("avx2");
+#else
+        return false;
+#endif
+    case Backend::NEON:
+#if defined(CPUKERNELS_HAVE_NEON)
+        return true;
+#else
+        return false;
+#endif
+    }
+    return false;
+}
+
+const char* CPUKernels::backendName(Backend backend)
+{
+    switch (backend) {
+    case Backend::Scalar: return "scalar";
+    case Backend::SSE2: return "SSE2";
+    case Backend::AVX2: return "AVX2";
+    case Backend::NEON: return "NEON";
+    }
+    return "unknown";
+}
+
+void CPUKernels::computeCoreDeltas(const CPUStatArrays &current, const CPUStatArrays &previous,
+                                   CPUDeltaArrays &output)
+{
+    computeCoreDeltas(activeBackend(), current, previous, output);
+}
+
+void CPUKernels::computeCoreDeltas(Backend backend, const CPUStatArrays &current,
+                                   const CPUStatArrays &previous, CPUDeltaArrays &output)
+{
+    if (current.stride() != previous.stride()) {
+        return;
+    }
+
+    if (output.count() != current.count() || output.stride() != current.stride()) {
+        output.resize(current.count(), current.stride());
+    }
+
+    KernelArgs args;
+    for (int f = 0; f < FIELD_COUNT; ++f) {
+        args.current[f] = current.column(f);
+        args.previous[f] = previous.column(f);
+        args.percent[f] = output.percent(f);
+    }
+    args.usage = output.usage();
+    args.stride = current.stride();
+
+    if (!isSupported(backend)) {
+        backend = Backend::Scalar;
+    }
+
+    switch (backend) {
+#if defined(CPUKERNELS_HAVE_AVX2)
+    case Backend::AVX2:
+        deltasAVX2(args);
+        return;
+#endif
+#if defined(CPUKERNELS_HAVE_SSE2)
+    case Backend::SSE2:
+        deltasSSE2(args);
+        return;
+#endif
+#if defined(CPUKERNELS_HAVE_NEON)
+    case Backend::NEON:
+        deltasNEON(args);
+        return;
+#endif
+    default:
+        deltasScalar(args);
+        return;
+    }
+}
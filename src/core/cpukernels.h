@@ -0,0 +1,103 @@
+/**
+ * @file cpukernels.h
+ * @brief Vectorized per-core CPU delta kernels (SSE2/AVX2/NEON/scalar)
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#ifndef CPUKERNELS_H
+#define CPUKERNELS_H
+
+#include <QtGlobal>
+#include <vector>
+#include "procparser.h"
+
+/**
+ * @brief Per-core kernel output as structure-of-arrays
+ * One double column per CPUStatArrays field (percent of the interval)
+ * plus one busy-usage column, padded like the input columns.
+ */
+class CPUDeltaArrays
+{
+public:
+    static const int USAGE = CPUStatArrays::FieldCount;
+
+    CPUDeltaArrays() : m_count(0), m_stride(0) {}
+
+    void resize(int count, int stride) {
+        m_count = count;
+        m_stride = stride;
+        m_storage.assign(static_cast<size_t>(stride) * (USAGE + 1), 0.0);
+    }
+
+    int count() const { return m_count; }
+    int stride() const { return m_stride; }
+
+    double* percent(int field) { return m_storage.data() + static_cast<size_t>(field) * m_stride; }
+    const double* percent(int field) const { return m_storage.data() + static_cast<size_t>(field) * m_stride; }
+    double* usage() { return percent(USAGE); }
+    const double* usage() const { return percent(USAGE); }
+
+private:
+    std::vector<double> m_storage;
+    int m_count;
+    int m_stride;
+};
+
+/**
+ * @brief current - previous, total, idle ratio and clamp for every core
+ *
+ * For each core: per-category delta (clamped at 0), total delta, each
+ * category as a percentage of the total and busy usage = 100 - idle%,
+ * clamped to 0-100. A core with no elapsed jiffies reports all zeroes.
+ *
+ * The SIMD paths convert counters with the 2^52 magic-number trick,
+ * exact for counters below 2^52 jiffies (over a million years at
+ * USER_HZ=100), and match the scalar path to rounding.
+ */
+class CPUKernels
+{
+public:
+    enum class Backend {
+        Scalar = 0,
+        SSE2,
+        AVX2,
+        NEON
+    };
+
+    /**
+     * @brief Best backend for this build and CPU (detected once)
+     */
+    static Backend activeBackend();
+
+    /**
+     * @brief Check if a backend is compiled in and supported by the CPU
+     */
+    static bool isSupported(Backend backend);
+
+    /**
+     * @brief Human readable backend name ("AVX2", "scalar", ...)
+     */
+    static const char* backendName(Backend backend);
+
+    /**
+     * @brief Run the delta kernel with the active backend
+     * @param current Counters of this sample
+     * @param previous Counters of the previous sample (same layout)
+     * @param output Result columns, resized when needed
+     */
+    static void computeCoreDeltas(const CPUStatArrays& current, const CPUStatArrays& previous,
+                                  CPUDeltaArrays& output);
+
+    /**
+     * @brief Run the delta kernel with an explicit backend (tests, benchmarks)
+     * Falls back to scalar when the backend is not supported.
+     */
+    static void computeCoreDeltas(Backend backend, const CPUStatArrays& current,
+                                  const CPUStatArrays& previous, CPUDeltaArrays& output);
+
+private:
+    CPUKernels() = delete; // Static class only
+};
+
+#endif // CPUKERNELS_H
@@ -0,0 +1,80 @@
+/**
+ * @file latencyhistogram.cpp
+ * @brief Log-linear latency histogram implementation
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#include "latencyhistogram.h"
+
+#include <cmath>
+#include <cstring>
+
+LatencyHistogram::LatencyHistogram()
+{
+    reset();
+}
+
+void LatencyHistogram::record(qint64 valueNs)
+{
+    const qint64 value = qMax<qint64>(0, valueNs);
+    ++m_buckets[bucketIndex(value)];
+    ++m_count;
+    m_max = qMax(m_max, value);
+}
+
+void LatencyHistogram::reset()
+{
+    memset(m_buckets, 0, sizeof(m_buckets));
+    m_count = 0;
+    m_max = 0;
+}
+
+qint64 LatencyHistogram::percentile(double percentile) const
+{
+    if (m_count == 0) return 0;
+
+    // Rank of the sample we are looking for, 1-based
+    const double share = qBound(0.0, percentile, 100.0) / 100.0;
+    const quint64 rank = qMax<quint64>(1, static_cast<quint64>(std::ceil(share * m_count)));
+
+    quint64 seen = 0;
+    for (int i = 0; i < BUCKET_COUNT; ++i) {
+        seen += m_buckets[i];
+        if (seen >= rank) {
+            return qMin(bucketUpperBound(i), m_max);
+        }
+    }
+    return m_max;
+}
+
+// ===================================================================
+// BUCKET MAPPING
+// ===================================================================
+
+int LatencyHistogram::bucketIndex(qint64 valueNs)
+{
+    const quint64 value = static_cast<quint64>(qMax<qint64>(0, valueNs));
+    if (value < static_cast<quint64>(SUB_BUCKET_COUNT)) {
+        return static_cast<int>(value);
+    }
+
+    // Highest set bit picks the power of two, the next SUB_BUCKET_BITS
+    // bits pick the linear sub-bucket inside it
+    const int exponent = 63 - __builtin_clzll(value);
+    const int shift = exponent - SUB_BUCKET_BITS;
+    const int index = (shift + 1) * SUB_BUCKET_COUNT +
+                      static_cast<int>((value >> shift) - SUB_BUCKET_COUNT);
+    return qMin(index, BUCKET_COUNT - 1);
+}
+
+qint64 LatencyHistogram::bucketUpperBound(int index)
+{
+    if (index < SUB_BUCKET_COUNT) {
+        return index;
+    }
+
+    const int shift = index / SUB_BUCKET_COUNT - 1;
+    const qint64 subBucket = index % SUB_BUCKET_COUNT + SUB_BUCKET_COUNT;
+    return ((subBucket + 1) << shift) - 1;
+}
@@ -0,0 +1,64 @@
+/**
+ * @file latencyhistogram.h
+ * @brief Fixed-bucket log-linear latency histogram (HDR style)
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#ifndef LATENCYHISTOGRAM_H
+#define LATENCYHISTOGRAM_H
+
+#include <QtGlobal>
+
+/**
+ * @brief Nanosecond latency histogram with bounded relative error
+ *
+ * Values below 16 ns get one bucket each. Above that, every power of
+ * two is split into 16 linear sub-buckets, so a reported percentile is
+ * within 1/16 (6.25%) of the true value. Values up to 2^40 ns
+ * (about 18 minutes) are tracked, larger ones land in the last bucket.
+ * Fixed storage, no allocation, record() is a few instructions.
+ *
+ * Not thread-safe: the owner serializes record() and the queries.
+ */
+class LatencyHistogram
+{
+public:
+    static const int SUB_BUCKET_BITS = 4;
+    static const int SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+    static const int MAX_VALUE_BITS = 40;
+    static const int BUCKET_COUNT = (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+    LatencyHistogram();
+
+    /**
+     * @brief Add one sample (negative values count as 0)
+     */
+    void record(qint64 valueNs);
+
+    /**
+     * @brief Drop every sample
+     */
+    void reset();
+
+    quint64 count() const { return m_count; }
+    qint64 max() const { return m_max; }
+
+    /**
+     * @brief Value at or below which the given share of samples fall
+     * @param percentile 0-100 (50 = median, 99 = p99)
+     * @return Upper bound of the matching bucket, capped at max(); 0 if empty
+     */
+    qint64 percentile(double percentile) const;
+
+    // Bucket mapping (exposed for tests)
+    static int bucketIndex(qint64 valueNs);
+    static qint64 bucketUpperBound(int index);
+
+private:
+    quint32 m_buckets[BUCKET_COUNT];
+    quint64 m_count;
+    qint64 m_max;
+};
+
+#endif // LATENCYHISTOGRAM_H
@@ -0,0 +1,235 @@
+/**
+ * @file pidmap.h
+ * @brief Open-addressing hash map keyed by process ID
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#ifndef PIDMAP_H
+#define PIDMAP_H
+
+#include <QtGlobal>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Flat PID -> T map with linear probing
+ *
+ * Built for per-tick process tables with tens of thousands of entries:
+ * one contiguous slot array, no per-entry allocation, Fibonacci hashing
+ * of the PID and at most 75% load. Removal shifts the following probe
+ * run back instead of leaving tombstones, so lookups never degrade
+ * under constant process churn.
+ *
+ * PIDs must be positive; 0 marks an empty slot. Pointers and references
+ * into the map stay valid until the next insert() or removal.
+ */
+template <typename T>
+class PidMap
+{
+public:
+    explicit PidMap(int capacity = 256)
+        : m_size(0)
+    {
+        rehash(capacityFor(capacity));
+    }
+
+    int size() const { return m_size; }
+    bool isEmpty() const { return m_size == 0; }
+    int capacity() const { return static_cast<int>(m_slots.size()); }
+
+    // Bytes held by the slot array
+    qint64 memoryFootprint() const
+    {
+        return static_cast<qint64>(m_slots.capacity() * sizeof(Slot));
+    }
+
+    /**
+     * @brief Value stored for pid, nullptr if none
+     */
+    T* find(qint32 pid)
+    {
+        for (size_t i = indexFor(pid); ; i = (i + 1) & m_mask) {
+            if (m_slots[i].pid == pid) return &m_slots[i].value;
+            if (m_slots[i].pid == EMPTY) return nullptr;
+        }
+    }
+
+    const T* find(qint32 pid) const
+    {
+        return const_cast<PidMap*>(this)->find(pid);
+    }
+
+    bool contains(qint32 pid) const { return find(pid) != nullptr; }
+
+    /**
+     * @brief Value stored for pid, default-constructed if new
+     * @param pid Process ID, > 0
+     * @param inserted Optional output, true if the entry was created
+     */
+    T& insert(qint32 pid, bool* inserted = nullptr)
+    {
+        Q_ASSERT(pid > 0);
+        if ((static_cast<size_t>(m_size) + 1) * 4 > m_slots.size() * 3) {
+            rehash(m_slots.size() * 2);
+        }
+
+        size_t i = indexFor(pid);
+        for (; m_slots[i].pid != EMPTY; i = (i + 1) & m_mask) {
+            if (m_slots[i].pid == pid) {
+                if (inserted) *inserted = false;
+                return m_slots[i].value;
+            }
+        }
+
+        m_slots[i].pid = pid;
+        ++m_size;
+        if (inserted) *inserted = true;
+        return m_slots[i].value;
+    }
+
+    /**
+     * @brief Remove pid
+     * @return true if it was present
+     */
+    bool remove(qint32 pid)
+    {
+        for (size_t i = indexFor(pid); m_slots[i].pid != EMPTY; i = (i + 1) & m_mask) {
+            if (m_slots[i].pid == pid) {
+                eraseAt(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Remove every entry for which predicate(pid, value) is true
+     * Single pass over the slots. An entry shifted back across the end of
+     * the array may be offered to the predicate twice.
+     * @return Number of entries removed
+     */
+    template <typename Predicate>
+    int removeIf(Predicate predicate)
+    {
+        int removed = 0;
+        for (size_t i = 0; i < m_slots.size(); ) {
+            Slot& slot = m_slots[i];
+            if (slot.pid != EMPTY && predicate(slot.pid, slot.value)) {
+                // Re-check this slot, eraseAt() may have shifted an entry in
+                eraseAt(i);
+                ++removed;
+            } else {
+                ++i;
+            }
+        }
+        return removed;
+    }
+
+    /**
+     * @brief Call function(pid, value) for every entry, in slot order
+     */
+    template <typename Function>
+    void forEach(Function function)
+    {
+        for (Slot& slot : m_slots) {
+            if (slot.pid != EMPTY) function(slot.pid, slot.value);
+        }
+    }
+
+    template <typename Function>
+    void forEach(Function function) const
+    {
+        for (const Slot& slot : m_slots) {
+            if (slot.pid != EMPTY) function(slot.pid, slot.value);
+        }
+    }
+
+    void clear()
+    {
+        for (Slot& slot : m_slots) {
+            slot = Slot();
+        }
+        m_size = 0;
+    }
+
+    /**
+     * @brief Make room for count entries without rehashing
+     */
+    void reserve(int count)
+    {
+        const size_t needed = capacityFor(count);
+        if (needed > m_slots.size()) {
+            rehash(needed);
+        }
+    }
+
+private:
+    static const qint32 EMPTY = 0;
+
+    struct Slot {
+        qint32 pid;
+        T value;
+
+        Slot() : pid(EMPTY), value() {}
+    };
+
+    // Power of two keeping count entries at or below 75% load
+    static size_t capacityFor(int count)
+    {
+        size_t capacity = 16;
+        while (capacity * 3 < static_cast<size_t>(qMax(count, 0)) * 4) {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    // Fibonacci hashing: consecutive PIDs spread over the whole table
+    size_t indexFor(qint32 pid) const
+    {
+        return static_cast<size_t>((static_cast<quint32>(pid) * 0x9E3779B9u) >> m_shift);
+    }
+
+    void rehash(size_t capacity)
+    {
+        std::vector<Slot> old;
+        old.swap(m_slots);
+        m_slots.resize(capacity);
+        m_mask = capacity - 1;
+        m_shift = 32;
+        for (size_t c = capacity; c > 1; c >>= 1) {
+            --m_shift;
+        }
+
+        for (Slot& slot : old) {
+            if (slot.pid == EMPTY) continue;
+            size_t i = indexFor(slot.pid);
+            while (m_slots[i].pid != EMPTY) {
+                i = (i + 1) & m_mask;
+            }
+            m_slots[i] = std::move(slot);
+        }
+    }
+
+    // Backward-shift deletion: pull later entries of the probe run into
+    // the hole when their home slot allows it
+    void eraseAt(size_t hole)
+    {
+        for (size_t next = (hole + 1) & m_mask; m_slots[next].pid != EMPTY; next = (next + 1) & m_mask) {
+            const size_t home = indexFor(m_slots[next].pid);
+            if (((next - home) & m_mask) >= ((next - hole) & m_mask)) {
+                m_slots[hole] = std::move(m_slots[next]);
+                hole = next;
+            }
+        }
+        m_slots[hole] = Slot();
+        --m_size;
+    }
+
+    std::vector<Slot> m_slots;
+    size_t m_mask;
+    int m_shift;
+    int m_size;
+};
+
+#endif // PIDMAP_H
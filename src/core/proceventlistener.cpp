@@ -0,0 +1,221 @@
+/**
+ * @file proceventlistener.cpp
+ * @brief Netlink proc connector listener implementation
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#include "proceventlistener.h"
+
+#include <cerrno>
+#include <cstring>
+#include <unistd.h>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/cn_proc.h>) && __has_include(<linux/connector.h>)
+#include <linux/cn_proc.h>
+#include <linux/connector.h>
+#include <linux/netlink.h>
+#include <sys/socket.h>
+#define PROCEVENTLISTENER_HAVE_CN_PROC 1
+#endif
+#endif
+
+namespace {
+
+// Large enough to ride out a fork storm between two ticks
+const int RECEIVE_BUFFER_SIZE = 1024 * 1024;
+
+// proc_event::what values (kernel ABI). Newer headers moved the enum out
+// of struct proc_event, so the names are not portable between them
+const quint32 EVENT_NONE = 0x00000000;
+const quint32 EVENT_FORK = 0x00000001;
+const quint32 EVENT_EXEC = 0x00000002;
+const quint32 EVENT_EXIT = 0x80000000;
+
+} // namespace
+
+ProcEventListener::ProcEventListener()
+    : m_socket(-1)
+    , m_error(0)
+    , m_overflow(false)
+    , m_buffer(16384)
+{
+}
+
+ProcEventListener::~ProcEventListener()
+{
+    stop();
+}
+
+// ===================================================================
+// SUBSCRIPTION
+// ===================================================================
+
+bool ProcEventListener::start()
+{
+    if (m_socket >= 0) return true;
+
+#if defined(PROCEVENTLISTENER_HAVE_CN_PROC)
+    m_error = 0;
+    m_overflow = false;
+
+    m_socket = ::socket(PF_NETLINK, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, NETLINK_CONNECTOR);
+    if (m_socket < 0) {
+        m_error = errno;
+        return false;
+    }
+
+    // Best effort: capped by net.core.rmem_max
+    const int bufferSize = RECEIVE_BUFFER_SIZE;
+    ::setsockopt(m_socket, SOL_SOCKET, SO_RCVBUF, &bufferSize, sizeof(bufferSize));
+
+    sockaddr_nl address;
+    memset(&address, 0, sizeof(address));
+    address.nl_family = AF_NETLINK;
+    address.nl_groups = CN_IDX_PROC;
+    if (::bind(m_socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 ||
+        !sendControl(PROC_CN_MCAST_LISTEN)) {
+        m_error = errno;
+        ::close(m_socket);
+        m_socket = -1;
+        return false;
+    }
+    return true;
+#else
+    m_error = ENOSYS;
+    return false;
+#endif
+}
+
+void ProcEventListener::stop()
+{
+    if (m_socket < 0) return;
+
+#if defined(PROCEVENTLISTENER_HAVE_CN_PROC)
+    sendControl(PROC_CN_MCAST_IGNORE);
+#endif
+    ::close(m_socket);
+    m_socket = -1;
+}
+
+bool ProcEventListener::sendControl(int operation)
+{
+#if defined(PROCEVENTLISTENER_HAVE_CN_PROC)
+    // nlmsghdr | cn_msg | proc_cn_mcast_op
+    alignas(nlmsghdr) char message[NLMSG_SPACE(sizeof(cn_msg) + sizeof(proc_cn_mcast_op))];
+    memset(message, 0, sizeof(message));
+
+    nlmsghdr* header = reinterpret_cast<nlmsghdr*>(message);
+    header->nlmsg_len = NLMSG_LENGTH(sizeof(cn_msg) + sizeof(proc_cn_mcast_op));
+    header->nlmsg_type = NLMSG_DONE;
+
+    cn_msg* connector = static_cast<cn_msg*>(NLMSG_DATA(header));
+    connector->id.idx = CN_IDX_PROC;
+    connector->id.val = CN_VAL_PROC;
+    connector->len = sizeof(proc_cn_mcast_op);
+    const proc_cn_mcast_op op = static_cast<proc_cn_mcast_op>(operation);
+    memcpy(connector->data, &op, sizeof(op));
+
+    ssize_t sent;
+    do {
+        sent = ::send(m_socket, message, header->nlmsg_len, 0);
+    } while (sent < 0 && errno == EINTR);
+    return sent == static_cast<ssize_t>(header->nlmsg_len);
+#else
+    Q_UNUSED(operation);
+    return false;
+#endif
+}
+
+// ===================================================================
+// EVENTS
+// ===================================================================
+
+int ProcEventListener::readEvents(std::vector<ProcEvent> &events)
+{
+    int count = 0;
+    while (m_socket >= 0) {
+        const ssize_t received = ::recv(m_socket, m_buffer.data(), m_buffer.size(), 0);
+        if (received < 0) {
+            if (errno == EINTR) continue;
+            if (errno == ENOBUFS) {
+                // The kernel dropped messages, the socket stays usable
+                m_overflow = true;
+                continue;
+            }
+            break;      // EAGAIN: drained
+        }
+        if (received == 0) break;
+
+        int ackError = 0;
+        count += parseMessages(m_buffer.data(), received, events, &ackError);
+        if (ackError != 0) {
+            // Subscription refused after the fact (e.g. EPERM)
+            m_error = ackError;
+            ::close(m_socket);
+            m_socket = -1;
+        }
+    }
+    return count;
+}
+
+bool ProcEventListener::takeOverflow()
+{
+    const bool overflow = m_overflow;
+    m_overflow = false;
+    return overflow;
+}
+
+int ProcEventListener::parseMessages(const char *data, qint64 size, std::vector<ProcEvent> &events,
+                                     int *error)
+{
+#if defined(PROCEVENTLISTENER_HAVE_CN_PROC)
+    int count = 0;
+    int length = static_cast<int>(size);
+    for (const nlmsghdr* header = reinterpret_cast<const nlmsghdr*>(data);
+         NLMSG_OK(header, length); header = NLMSG_NEXT(header, length)) {
+        if (header->nlmsg_type == NLMSG_NOOP || header->nlmsg_type == NLMSG_ERROR) continue;
+        if (header->nlmsg_len < NLMSG_LENGTH(sizeof(cn_msg) + sizeof(proc_event))) continue;
+
+        const cn_msg* connector = static_cast<const cn_msg*>(NLMSG_DATA(header));
+        if (connector->id.idx != CN_IDX_PROC || connector->id.val != CN_VAL_PROC) continue;
+
+        const proc_event* event = reinterpret_cast<const proc_event*>(connector->data);
+        switch (static_cast<quint32>(event->what)) {
+        case EVENT_FORK:
+            // New threads fork too: only a new thread group is a process
+            if (event->event_data.fork.child_pid == event->event_data.fork.child_tgid) {
+                events.emplace_back(ProcEvent::Fork, event->event_data.fork.child_tgid);
+                ++count;
+            }
+            break;
+        case EVENT_EXEC:
+            events.emplace_back(ProcEvent::Exec, event->event_data.exec.process_tgid);
+            ++count;
+            break;
+        case EVENT_EXIT:
+            if (event->event_data.exit.process_pid == event->event_data.exit.process_tgid) {
+                events.emplace_back(ProcEvent::Exit, event->event_data.exit.process_tgid);
+                ++count;
+            }
+            break;
+        case EVENT_NONE:
+            // Acknowledgement of a LISTEN/IGNORE request
+            if (error && event->event_data.ack.err != 0) {
+                *error = static_cast<int>(event->event_data.ack.err);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    return count;
+#else
+    Q_UNUSED(data);
+    Q_UNUSED(size);
+    Q_UNUSED(events);
+    Q_UNUSED(error);
+    return 0;
+#endif
+}
@@ -0,0 +1,106 @@
+/**
+ * @file proceventlistener.h
+ * @brief Process fork/exec/exit events from the netlink proc connector
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#ifndef PROCEVENTLISTENER_H
+#define PROCEVENTLISTENER_H
+
+#include <QtGlobal>
+#include <vector>
+
+/**
+ * @brief One process lifecycle event, thread events already filtered out
+ */
+struct ProcEvent {
+    enum Type {
+        Fork = 0,       // New process (thread group leader)
+        Exec,           // Process replaced its image
+        Exit            // Process (thread group) exited
+    };
+
+    Type type;
+    qint32 pid;         // Thread group ID, what /proc lists
+
+    ProcEvent() : type(Fork), pid(0) {}
+    ProcEvent(Type eventType, qint32 eventPid) : type(eventType), pid(eventPid) {}
+};
+
+/**
+ * @brief Non-blocking subscriber to the kernel's proc connector
+ *
+ * Joins the CN_IDX_PROC multicast group on a NETLINK_CONNECTOR socket
+ * and asks for PROC_EVENT_* messages. The socket is never waited on:
+ * the owner drains it once per tick with readEvents().
+ *
+ * Subscribing needs CAP_NET_ADMIN on most kernels; start() then fails
+ * and the owner keeps polling /proc. The kernel drops messages when the
+ * socket buffer is full, which readEvents() reports as an overflow so
+ * the owner can rescan. Events describe the initial PID and network
+ * namespaces only.
+ */
+class ProcEventListener
+{
+public:
+    ProcEventListener();
+    ~ProcEventListener();
+
+    ProcEventListener(const ProcEventListener&) = delete;
+    ProcEventListener& operator=(const ProcEventListener&) = delete;
+
+    /**
+     * @brief Open the socket and subscribe
+     * @return false if not permitted or not supported, see error()
+     */
+    bool start();
+
+    /**
+     * @brief Unsubscribe and close the socket
+     */
+    void stop();
+
+    bool isActive() const { return m_socket >= 0; }
+
+    /**
+     * @brief errno of the last failure, 0 if none
+     */
+    int error() const { return m_error; }
+
+    /**
+     * @brief Append every queued event, never blocks
+     * A refused subscription (reported asynchronously by the kernel)
+     * stops the listener.
+     * @param events Output, appended to
+     * @return Number of events appended
+     */
+    int readEvents(std::vector<ProcEvent>& events);
+
+    /**
+     * @brief Whether events were lost since the last call
+     * Resets the flag.
+     */
+    bool takeOverflow();
+
+    /**
+     * @brief Decode a buffer of netlink connector messages
+     * @param data Datagram as received from the socket
+     * @param size Datagram length in bytes
+     * @param events Output, appended to
+     * @param error Optional output, errno of a subscription ack
+     * @return Number of events appended
+     */
+    static int parseMessages(const char* data, qint64 size, std::vector<ProcEvent>& events,
+                             int* error = nullptr);
+
+private:
+    bool sendControl(int operation);
+
+    int m_socket;
+    int m_error;
+    bool m_overflow;
+    std::vector<char> m_buffer;
+};
+
+#endif // PROCEVENTLISTENER_H
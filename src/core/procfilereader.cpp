@@ -0,0 +1,153 @@
+/**
+ * @file procfilereader.cpp
+ * @brief Persistent-descriptor /proc reader implementation
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#include "procfilereader.h"
+
+#include <QDebug>
+#include <charconv>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+ProcFileReader::ProcFileReader(const QString &filePath, int initialCapacity)
+    : m_filePath(filePath)
+    , m_size(0)
+    , m_fd(-1)
+{
+    m_buffer.resize(qMax(64, initialCapacity));
+    m_buffer[0] = '\0';
+}
+
+ProcFileReader::~ProcFileReader()
+{
+    close();
+}
+
+// ===================================================================
+// DESCRIPTOR MANAGEMENT
+// ===================================================================
+
+bool ProcFileReader::open()
+{
+    if (m_fd >= 0) return true;
+    if (m_filePath.isEmpty()) return false;
+
+    m_fd = ::open(m_filePath.toLocal8Bit().constData(), O_RDONLY | O_CLOEXEC);
+    if (m_fd < 0) {
+        qWarning() << "Cannot open file: " << m_filePath << "Error: " << strerror(errno);
+        return false;
+    }
+
+    return true;
+}
+
+void ProcFileReader::close()
+{
+    if (m_fd >= 0) {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+}
+
+void ProcFileReader::setFilePath(const QString &filePath)
+{
+    close();
+    m_filePath = filePath;
+    m_size = 0;
+    m_buffer[0] = '\0';
+}
+
+// ===================================================================
+// READ OPERATIONS
+// ===================================================================
+
+qint64 ProcFileReader::read()
+{
+    if (m_fd < 0 && !open()) {
+        return -1;
+    }
+
+    for (;;) {
+        // Keep one byte for the NUL terminator
+        const qint64 capacity = m_buffer.size() - 1;
+        char* buffer = m_buffer.data();
+
+        ssize_t bytesRead;
+        do {
+            bytesRead = ::pread(m_fd, buffer, static_cast<size_t>(capacity), 0);
+        } while (bytesRead < 0 && errno == EINTR);
+
+        if (bytesRead < 0) {
+            qWarning() << "Cannot read file: " << m_filePath << "Error: " << strerror(errno);
+            m_size = 0;
+            buffer[0] = '\0';
+            return -1;
+        }
+
+        // seq_file and sysfs hand out the whole content in one call,
+        // so a short read is the end of file. A full buffer means the
+        // file outgrew it: grow and re-read from offset 0 for a
+        // consistent snapshot.
+        if (bytesRead < capacity) {
+            buffer[bytesRead] = '\0';
+            m_size = bytesRead;
+            return m_size;
+        }
+
+        m_buffer.resize(m_buffer.size() * 2);
+    }
+}
+
+bool ProcFileReader::readInt64(qint64 *value)
+{
+    if (read() <= 0) {
+        return false;
+    }
+
+    return toInt64(value);
+}
+
+bool ProcFileReader::toInt64(qint64 *value) const
+{
+    if (m_size <= 0) {
+        return false;
+    }
+
+    const char* begin = data();
+    const char* end = begin + m_size;
+    while (begin < end && (*begin == ' ' || *begin == '\t')) {
+        ++begin;
+    }
+
+    long long parsed = 0;
+    std::from_chars_result result = std::from_chars(begin, end, parsed);
+    if (result.ec != std::errc()) {
+        return false;
+    }
+
+    *value = parsed;
+    return true;
+}
+
+bool ProcFileReader::completeRead(qint64 bytesRead)
+{
+    if (bytesRead < 0) {
+        m_size = 0;
+        m_buffer[0] = '\0';
+        return true;
+    }
+
+    // Same rule as read(): a full buffer may be a truncated file
+    if (bytesRead >= capacity()) {
+        return false;
+    }
+
+    m_buffer[static_cast<int>(bytesRead)] = '\0';
+    m_size = bytesRead;
+    return true;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file procfilereader.h
+ * @brief Persistent-descriptor reader for /proc and sysfs files
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#ifndef PROCFILEREADER_H
+#define PROCFILEREADER_H
+
+#include <QString>
+#include <QByteArray>
+
+/**
+ * @brief Re-reads a /proc or sysfs file through one open descriptor
+ *
+ * The file is opened once and every read() re-fetches the whole content
+ * with pread() at offset 0 into a reusable byte buffer. No QFile, no
+ * UTF-16 conversion and no open/close pair per sample. The buffer grows
+ * when the file outgrows it and is kept NUL-terminated for the parsers.
+ */
+class ProcFileReader
+{
+public:
+    explicit ProcFileReader(const QString& filePath = QString(), int initialCapacity = 4096);
+    ~ProcFileReader();
+
+    ProcFileReader(const ProcFileReader&) = delete;
+    ProcFileReader& operator=(const ProcFileReader&) = delete;
+
+    // ===================================================================
+    // DESCRIPTOR MANAGEMENT
+    // ===================================================================
+
+    /**
+     * @brief Open the file (read-only, close-on-exec)
+     * @return true if descriptor is valid
+     */
+    bool open();
+
+    /**
+     * @brief Close the descriptor, buffer is kept for reuse
+     */
+    void close();
+
+    /**
+     * @brief Change target path (closes the current descriptor)
+     * @param filePath New file path
+     */
+    void setFilePath(const QString& filePath);
+
+    QString filePath() const { return m_filePath; }
+    bool isOpen() const { return m_fd >= 0; }
+
+    // ===================================================================
+    // READ OPERATIONS
+    // ===================================================================
+
+    /**
+     * @brief Re-read the whole file from offset 0
+     * Opens lazily on first call.
+     * @return Number of bytes read, -1 on error
+     */
+    qint64 read();
+
+    /**
+     * @brief Read a single integer value (sysfs style "12345\n")
+     * @param value Output value
+     * @return true if a number was read
+     */
+    bool readInt64(qint64* value);
+
+    /**
+     * @brief Parse the last read content as a single integer
+     * @param value Output value
+     * @return true if a number was found
+     */
+    bool toInt64(qint64* value) const;
+
+    // ===================================================================
+    // BATCHED READS (ProcReadBatch)
+    // ===================================================================
+
+    int fd() const { return m_fd; }
+    char* buffer() { return m_buffer.data(); }
+    // Bytes a single read may fill, one byte is kept for the terminator
+    qint64 capacity() const { return m_buffer.size() - 1; }
+
+    /**
+     * @brief Store the result of a read issued outside read()
+     * @param bytesRead Read result, negative errno on failure
+     * @return false if the buffer was filled (caller falls back to read())
+     */
+    bool completeRead(qint64 bytesRead);
+
+    // Last read content (NUL-terminated, valid until next read())
+    const char* data() const { return m_buffer.constData(); }
+    qint64 size() const { return m_size; }
+
+private:
+    QString m_filePath;
+    QByteArray m_buffer;
+    qint64 m_size;
+    int m_fd;
+};
+
+#endif // PROCFILEREADER_H
@@ -0,0 +1,571 @@
+/**
+ * @file procparser.cpp
+ * @brief Byte-level /proc parser implementation
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#include "procparser.h"
+#include "constants.h"
+
+#include <charconv>
+#include <cstring>
+
+namespace {
+
+inline const char* skipBlanks(const char* p, const char* end)
+{
+    while (p < end && (*p == ' ' || *p == '\t')) {
+        ++p;
+    }
+    return p;
+}
+
+inline const char* nextLine(const char* p, const char* end)
+{
+    const char* newline = static_cast<const char*>(memchr(p, '\n', static_cast<size_t>(end - p)));
+    return newline ? newline + 1 : end;
+}
+
+inline const char* parseCounter(const char* p, const char* end, qint64* value)
+{
+    p = skipBlanks(p, end);
+    unsigned long long parsed = 0;
+    std::from_chars_result result = std::from_chars(p, end, parsed);
+    if (result.ec != std::errc()) {
+        return nullptr;
+    }
+    *value = static_cast<qint64>(parsed);
+    return result.ptr;
+}
+
+// "12.34" as the kernel prints fixed-point values, no locale involved
+inline const char* parseDecimal(const char* p, const char* end, double* value)
+{
+    p = skipBlanks(p, end);
+    quint64 whole = 0;
+    std::from_chars_result result = std::from_chars(p, end, whole);
+    if (result.ec != std::errc()) {
+        return nullptr;
+    }
+    p = result.ptr;
+
+    double fraction = 0.0;
+    if (p < end && *p == '.') {
+        double scale = 0.1;
+        for (++p; p < end && *p >= '0' && *p <= '9'; ++p) {
+            fraction += (*p - '0') * scale;
+            scale *= 0.1;
+        }
+    }
+    *value = static_cast<double>(whole) + fraction;
+    return p;
+}
+
+} // namespace
+
+// ===================================================================
+// MEMORY (/proc/meminfo)
+// ===================================================================
+
+bool ProcParser::parseMemInfo(const char *data, qint64 size, MemoryData &memory)
+{
+    enum Key {
+        MemTotal = 0, MemFree, MemAvailable, Buffers, Cached,
+        SwapTotal, SwapFree, Dirty, Writeback, Shmem,
+        SReclaimable, CommittedAS, KeyCount
+    };
+
+    // Same order as the kernel prints them, so the match loop usually
+    // hits on its first comparison
+    static const struct { const char* name; size_t length; } keys[KeyCount] = {
+        {"MemTotal", 8}, {"MemFree", 7}, {"MemAvailable", 12}, {"Buffers", 7},
+        {"Cached", 6}, {"SwapTotal", 9}, {"SwapFree", 8}, {"Dirty", 5},
+        {"Writeback", 9}, {"Shmem", 5}, {"SReclaimable", 12}, {"Committed_AS", 12}
+    };
+
+    qint64 values[KeyCount] = {};
+    bool found[KeyCount] = {};
+    int foundCount = 0;
+    int nextKey = 0;
+
+    const char* p = data;
+    const char* end = data + size;
+
+    while (p < end && foundCount < KeyCount) {
+        const char* lineEnd = nextLine(p, end);
+        const char* colon = static_cast<const char*>(memchr(p, ':', static_cast<size_t>(lineEnd - p)));
+        if (!colon) {
+            p = lineEnd;
+            continue;
+        }
+
+        const size_t keyLength = static_cast<size_t>(colon - p);
+        int key = -1;
+        for (int i = 0; i < KeyCount; ++i) {
+            const int candidate = (nextKey + i) % KeyCount;
+            if (!found[candidate] && keys[candidate].length == keyLength &&
+                memcmp(keys[candidate].name, p, keyLength) == 0) {
+                key = candidate;
+                break;
+            }
+        }
+
+        if (key >= 0) {
+            const char* valueStart = skipBlanks(colon + 1, lineEnd);
+            unsigned long long value = 0;
+            std::from_chars_result result = std::from_chars(valueStart, lineEnd, value);
+            if (result.ec == std::errc()) {
+                // Values are in kB unless the unit is missing (HugePages_*)
+                const char* unit = skipBlanks(result.ptr, lineEnd);
+                const bool isKiloBytes = (lineEnd - unit >= 2 && unit[0] == 'k' && unit[1] == 'B');
+                values[key] = static_cast<qint64>(value) * (isKiloBytes ? BYTES_PER_KB : 1);
+                found[key] = true;
+                ++foundCount;
+                nextKey = key + 1;
+            }
+        }
+
+        p = lineEnd;
+    }
+
+    if (!found[MemTotal]) {
+        return false;
+    }
+
+    memory.totalRAM = values[MemTotal];
+    memory.freeRAM = values[MemFree];
+    memory.buffers = values[Buffers];
+    memory.cached = values[Cached];
+    memory.swapTotal = values[SwapTotal];
+    memory.swapUsed = qMax<qint64>(0, values[SwapTotal] - values[SwapFree]);
+    memory.shmem = values[Shmem];
+    memory.sReclaimable = values[SReclaimable];
+    memory.dirty = values[Dirty];
+    memory.writeback = values[Writeback];
+    memory.committedAS = values[CommittedAS];
+
+    // MemAvailable exists since Linux 3.14, estimate it on older kernels
+    memory.availableRAM = found[MemAvailable]
+        ? values[MemAvailable]
+        : values[MemFree] + values[Buffers] + values[Cached] + values[SReclaimable];
+
+    memory.usedRAM = qMax<qint64>(0, memory.totalRAM - memory.availableRAM);
+
+    return true;
+}
+
+// ===================================================================
+// CPU (/proc/stat)
+// ===================================================================
+
+bool ProcParser::parseCPUStat(const char *data, qint64 size, CPUStat &total,
+                              CPUStatArrays &cores, ProcStatCounters *counters)
+{
+    cores.clear();
+
+    quint64* columns[CPUStatArrays::FieldCount];
+    for (int field = 0; field < CPUStatArrays::FieldCount; ++field) {
+        columns[field] = cores.column(field);
+    }
+    const unsigned int coreCount = static_cast<unsigned int>(cores.count());
+
+    bool foundTotal = false;
+    const char* p = data;
+    const char* end = data + size;
+
+    // "cpu" lines are always first, stop at the first other key
+    while (end - p > 3 && memcmp(p, "cpu", 3) == 0) {
+        p += 3;
+
+        if (*p == ' ') {
+            // user nice system idle iowait irq softirq steal; guest and
+            // guest_nice are already accounted in user and nice
+            qint64* fields[] = {
+                &total.user, &total.nice, &total.system, &total.idle,
+                &total.iowait, &total.irq, &total.softirq, &total.steal
+            };
+            for (qint64* field : fields) {
+                const char* next = parseCounter(p, end, field);
+                if (!next) {
+                    *field = 0;
+                    continue;
+                }
+                p = next;
+            }
+            foundTotal = true;
+        } else {
+            unsigned int coreIndex = 0;
+            std::from_chars_result result = std::from_chars(p, end, coreIndex);
+            if (result.ec == std::errc() && coreIndex < coreCount) {
+                p = result.ptr;
+                for (int field = 0; field < CPUStatArrays::FieldCount; ++field) {
+                    qint64 value = 0;
+                    const char* next = parseCounter(p, end, &value);
+                    if (!next) break;
+                    columns[field][coreIndex] = static_cast<quint64>(value);
+                    p = next;
+                }
+            }
+        }
+
+        p = nextLine(p, end);
+    }
+
+    if (!counters) {
+        return foundTotal;
+    }
+
+    // Tail: "key value [more columns]" lines after the cpu block
+    while (p < end) {
+        const char* keyEnd = p;
+        while (keyEnd < end && *keyEnd != ' ' && *keyEnd != '\n') {
+            ++keyEnd;
+        }
+        const size_t keyLength = static_cast<size_t>(keyEnd - p);
+
+        qint64* target = nullptr;
+        qint64 gauge = 0;
+        int* gaugeTarget = nullptr;
+
+        switch (keyLength) {
+        case 4:
+            if (memcmp(p, "intr", 4) == 0) target = &counters->interrupts;
+            else if (memcmp(p, "ctxt", 4) == 0) target = &counters->contextSwitches;
+            break;
+        case 5:
+            if (memcmp(p, "btime", 5) == 0) target = &counters->bootTime;
+            break;
+        case 7:
+            if (memcmp(p, "softirq", 7) == 0) target = &counters->softirqs;
+            break;
+        case 9:
+            if (memcmp(p, "processes", 9) == 0) target = &counters->processesCreated;
+            break;
+        case 13:
+            if (memcmp(p, "procs_running", 13) == 0) gaugeTarget = &counters->procsRunning;
+            else if (memcmp(p, "procs_blocked", 13) == 0) gaugeTarget = &counters->procsBlocked;
+            break;
+        default:
+            break;
+        }
+
+        if (target) {
+            parseCounter(keyEnd, end, target);
+        } else if (gaugeTarget && parseCounter(keyEnd, end, &gauge)) {
+            *gaugeTarget = static_cast<int>(gauge);
+        }
+
+        p = nextLine(keyEnd, end);
+    }
+
+    return foundTotal;
+}
+
+// ===================================================================
+// NETWORK (/proc/net/dev)
+// ===================================================================
+
+int ProcParser::parseNetDev(const char *data, qint64 size, std::vector<NetDevStat> &interfaces)
+{
+    const char* p = data;
+    const char* end = data + size;
+
+    // "Inter-|   Receive ..." and " face |bytes    packets ..."
+    p = nextLine(p, end);
+    p = nextLine(p, end);
+
+    size_t count = 0;
+    while (p < end) {
+        const char* lineEnd = nextLine(p, end);
+        p = skipBlanks(p, lineEnd);
+
+        // Interface names cannot contain ':' or blanks
+        const char* colon = static_cast<const char*>(memchr(p, ':', static_cast<size_t>(lineEnd - p)));
+        const int nameLength = colon ? static_cast<int>(colon - p) : 0;
+        if (nameLength <= 0 || nameLength >= NetDevStat::NAME_SIZE) {
+            p = lineEnd;
+            continue;
+        }
+
+        if (count == interfaces.size()) {
+            interfaces.emplace_back();
+        }
+        NetDevStat& stat = interfaces[count];
+        memcpy(stat.name, p, static_cast<size_t>(nameLength));
+        stat.name[nameLength] = '\0';
+        stat.nameLength = nameLength;
+
+        p = colon + 1;
+        int column = 0;
+        for (; column < NetDevStat::CounterCount; ++column) {
+            qint64 value = 0;
+            const char* next = parseCounter(p, lineEnd, &value);
+            if (!next) break;
+            stat.counters[column] = static_cast<quint64>(value);
+            p = next;
+        }
+
+        // A line cut short is not an interface
+        if (column == NetDevStat::CounterCount) {
+            ++count;
+        }
+        p = lineEnd;
+    }
+
+    interfaces.resize(count);
+    return static_cast<int>(count);
+}
+
+// ===================================================================
+// STORAGE (/proc/diskstats, /proc/mounts)
+// ===================================================================
+
+int ProcParser::parseDiskStats(const char *data, qint64 size, std::vector<DiskStat> &devices)
+{
+    const char* p = data;
+    const char* end = data + size;
+
+    size_t count = 0;
+    while (p < end) {
+        const char* lineEnd = nextLine(p, end);
+
+        // "   8       0 sda 1234 ..."
+        unsigned int major = 0;
+        unsigned int minor = 0;
+        p = skipBlanks(p, lineEnd);
+        std::from_chars_result result = std::from_chars(p, lineEnd, major);
+        if (result.ec == std::errc()) {
+            p = skipBlanks(result.ptr, lineEnd);
+            result = std::from_chars(p, lineEnd, minor);
+        }
+        if (result.ec != std::errc()) {
+            p = lineEnd;
+            continue;
+        }
+
+        const char* name = skipBlanks(result.ptr, lineEnd);
+        const char* nameEnd = name;
+        while (nameEnd < lineEnd && *nameEnd != ' ' && *nameEnd != '\t' && *nameEnd != '\n') {
+            ++nameEnd;
+        }
+        const int nameLength = static_cast<int>(nameEnd - name);
+        if (nameLength <= 0 || nameLength >= DiskStat::NAME_SIZE) {
+            p = lineEnd;
+            continue;
+        }
+
+        if (count == devices.size()) {
+            devices.emplace_back();
+        }
+        DiskStat& stat = devices[count];
+        stat.devMajor = major;
+        stat.devMinor = minor;
+        memcpy(stat.name, name, static_cast<size_t>(nameLength));
+        stat.name[nameLength] = '\0';
+        stat.nameLength = nameLength;
+
+        p = nameEnd;
+        int column = 0;
+        for (; column < DiskStat::CounterCount; ++column) {
+            qint64 value = 0;
+            const char* next = parseCounter(p, lineEnd, &value);
+            if (!next) break;
+            stat.counters[column] = static_cast<quint64>(value);
+            p = next;
+        }
+
+        // Older kernels stop after 11 or 15 columns
+        if (column >= DiskStat::REQUIRED_COUNTERS) {
+            std::fill(stat.counters + column, stat.counters + DiskStat::CounterCount, 0);
+            ++count;
+        }
+        p = lineEnd;
+    }
+
+    devices.resize(count);
+    return static_cast<int>(count);
+}
+
+namespace {
+
+// "/mnt/my\040disk" -> "/mnt/my disk"
+QString decodeMountField(const char* p, const char* end)
+{
+    QByteArray field;
+    field.reserve(static_cast<int>(end - p));
+    while (p < end) {
+        if (*p == '\\' && end - p >= 4 &&
+            p[1] >= '0' && p[1] <= '3' && p[2] >= '0' && p[2] <= '7' && p[3] >= '0' && p[3] <= '7') {
+            field.append(static_cast<char>(((p[1] - '0') << 6) | ((p[2] - '0') << 3) | (p[3] - '0')));
+            p += 4;
+        } else {
+            field.append(*p++);
+        }
+    }
+    return QString::fromUtf8(field);
+}
+
+} // namespace
+
+int ProcParser::parseMounts(const char *data, qint64 size, QVector<MountEntry> &mounts)
+{
+    const char* p = data;
+    const char* end = data + size;
+
+    mounts.clear();
+    while (p < end) {
+        const char* lineEnd = nextLine(p, end);
+
+        // "device mountpoint fstype options dump pass"
+        const char* fields[3];
+        const char* fieldEnds[3];
+        int found = 0;
+        for (; found < 3; ++found) {
+            p = skipBlanks(p, lineEnd);
+            const char* fieldEnd = p;
+            while (fieldEnd < lineEnd && *fieldEnd != ' ' && *fieldEnd != '\t' && *fieldEnd != '\n') {
+                ++fieldEnd;
+            }
+            if (fieldEnd == p) break;
+            fields[found] = p;
+            fieldEnds[found] = fieldEnd;
+            p = fieldEnd;
+        }
+
+        if (found == 3) {
+            MountEntry entry;
+            entry.device = decodeMountField(fields[0], fieldEnds[0]);
+            entry.mountPoint = decodeMountField(fields[1], fieldEnds[1]);
+            entry.fileSystem = decodeMountField(fields[2], fieldEnds[2]);
+            mounts.append(entry);
+        }
+        p = lineEnd;
+    }
+
+    return mounts.size();
+}
+
+// ===================================================================
+// PROCESSES (/proc/<pid>/stat, /proc/<pid>/statm)
+// ===================================================================
+
+bool ProcParser::parsePidStat(const char *data, qint64 size, ProcPidStat &stat)
+{
+    const char* end = data + size;
+
+    // "pid (comm) state ppid ..."
+    std::from_chars_result result = std::from_chars(data, end, stat.pid);
+    if (result.ec != std::errc()) return false;
+
+    const char* open = static_cast<const char*>(memchr(result.ptr, '(', static_cast<size_t>(end - result.ptr)));
+    const char* close = static_cast<const char*>(memrchr(data, ')', static_cast<size_t>(size)));
+    if (!open || !close || close < open) return false;
+
+    stat.commLength = static_cast<int>(qMin<qint64>(close - open - 1, ProcPidStat::COMM_SIZE - 1));
+    memcpy(stat.comm, open + 1, static_cast<size_t>(stat.commLength));
+    stat.comm[stat.commLength] = '\0';
+
+    const char* p = skipBlanks(close + 1, end);
+    if (p >= end) return false;
+    stat.state = *p++;
+
+    // Fields 4 (ppid) to 24 (rss), 1-based as in proc(5)
+    for (int field = 4; field <= 24; ++field) {
+        p = skipBlanks(p, end);
+        const char* token = p;
+        while (p < end && *p != ' ' && *p != '\n') ++p;
+        if (token == p) return false;
+
+        switch (field) {
+        case 4:  result = std::from_chars(token, p, stat.parentPid); break;
+        case 14: result = std::from_chars(token, p, stat.userTime); break;
+        case 15: result = std::from_chars(token, p, stat.systemTime); break;
+        case 20: result = std::from_chars(token, p, stat.threadCount); break;
+        case 22: result = std::from_chars(token, p, stat.startTime); break;
+        case 23: result = std::from_chars(token, p, stat.virtualSize); break;
+        case 24: result = std::from_chars(token, p, stat.residentPages); break;
+        default: continue;
+        }
+        if (result.ec != std::errc()) return false;
+    }
+    return true;
+}
+
+bool ProcParser::parsePidStatm(const char *data, qint64 size, ProcPidStatm &statm)
+{
+    const char* p = data;
+    const char* end = data + size;
+
+    // size resident shared text lib data dt; lib and dt are always 0
+    qint64 lib = 0;
+    qint64* fields[] = { &statm.size, &statm.resident, &statm.shared, &statm.text, &lib, &statm.data };
+    for (qint64* field : fields) {
+        p = skipBlanks(p, end);
+        std::from_chars_result result = std::from_chars(p, end, *field);
+        if (result.ec != std::errc()) return false;
+        p = result.ptr;
+    }
+    return true;
+}
+
+// ===================================================================
+// SYSTEM LOAD (/proc/loadavg, /proc/uptime)
+// ===================================================================
+
+bool ProcParser::parseLoadAvg(const char *data, qint64 size, LoadAvgStat &load)
+{
+    const char* p = data;
+    const char* end = data + size;
+
+    double* averages[] = { &load.load1, &load.load5, &load.load15 };
+    for (double* average : averages) {
+        p = parseDecimal(p, end, average);
+        if (!p) return false;
+    }
+
+    // "running/total"
+    p = skipBlanks(p, end);
+    std::from_chars_result result = std::from_chars(p, end, load.runningTasks);
+    if (result.ec != std::errc() || result.ptr >= end || *result.ptr != '/') {
+        return false;
+    }
+    result = std::from_chars(result.ptr + 1, end, load.totalTasks);
+    return result.ec == std::errc();
+}
+
+bool ProcParser::parseUptime(const char *data, qint64 size, double *uptimeSeconds, double *idleSeconds)
+{
+    const char* end = data + size;
+
+    const char* p = parseDecimal(data, end, uptimeSeconds);
+    if (!p) return false;
+
+    if (idleSeconds && !parseDecimal(p, end, idleSeconds)) {
+        *idleSeconds = 0.0;
+    }
+    return true;
+}
+
+// ===================================================================
+// COUNTERS
+// ===================================================================
+
+quint64 ProcParser::counterDelta(quint64 previous, quint64 current, bool wideCounters)
+{
+    const quint64 counter32Max = 0xFFFFFFFFULL;
+
+    if (current >= previous) {
+        return current - previous;
+    }
+
+    // unsigned long wrapped at 32 bits. More than 2^31 in one interval
+    // is not plausible: that is a reset too.
+    if (!wideCounters && previous <= counter32Max && current <= counter32Max) {
+        const quint64 wrapped = current + (counter32Max - previous) + 1;
+        if (wrapped <= counter32Max / 2) return wrapped;
+    }
+
+    // Reset: the counter started over, no meaningful delta
+    return 0;
+}
@@ -0,0 +1,373 @@
+/**
+ * @file procparser.h
+ * @brief Byte-level parsers for raw /proc file buffers
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#ifndef PROCPARSER_H
+#define PROCPARSER_H
+
+#include <QtGlobal>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+#include "types.h"
+
+/**
+ * @brief Raw jiffy counters of one "cpu" line in /proc/stat
+ */
+struct CPUStat {
+    qint64 user, nice, system, idle, iowait, irq, softirq, steal;
+
+    qint64 total() const {
+        return user + nice + system + idle + iowait + irq + softirq + steal;
+    }
+
+    qint64 active() const {
+        return total() - idle - iowait;
+    }
+
+    CPUStat() : user(0), nice(0), system(0), idle(0), iowait(0), irq(0), softirq(0), steal(0) {}
+};
+
+/**
+ * @brief Per-core /proc/stat counters as structure-of-arrays
+ *
+ * One contiguous uint64 column per category. Columns are padded with
+ * zeroes to a multiple of PADDING entries so vector kernels can run
+ * full lanes without a scalar tail.
+ */
+class CPUStatArrays
+{
+public:
+    enum Field { User = 0, Nice, System, Idle, IOWait, IRQ, SoftIRQ, Steal, FieldCount };
+    static const int PADDING = 4;
+
+    CPUStatArrays() : m_count(0), m_stride(0) {}
+
+    void resize(int count) {
+        m_count = qMax(0, count);
+        m_stride = (m_count + PADDING - 1) / PADDING * PADDING;
+        m_storage.assign(static_cast<size_t>(m_stride) * FieldCount, 0);
+    }
+
+    // Zero every counter, keeps the allocation
+    void clear() { std::fill(m_storage.begin(), m_storage.end(), 0); }
+
+    int count() const { return m_count; }
+    int stride() const { return m_stride; }
+
+    quint64* column(int field) { return m_storage.data() + static_cast<size_t>(field) * m_stride; }
+    const quint64* column(int field) const { return m_storage.data() + static_cast<size_t>(field) * m_stride; }
+
+    // AoS view of one core (tests, debugging)
+    CPUStat at(int index) const {
+        CPUStat stat;
+        stat.user = static_cast<qint64>(column(User)[index]);
+        stat.nice = static_cast<qint64>(column(Nice)[index]);
+        stat.system = static_cast<qint64>(column(System)[index]);
+        stat.idle = static_cast<qint64>(column(Idle)[index]);
+        stat.iowait = static_cast<qint64>(column(IOWait)[index]);
+        stat.irq = static_cast<qint64>(column(IRQ)[index]);
+        stat.softirq = static_cast<qint64>(column(SoftIRQ)[index]);
+        stat.steal = static_cast<qint64>(column(Steal)[index]);
+        return stat;
+    }
+
+private:
+    std::vector<quint64> m_storage;
+    int m_count;
+    int m_stride;
+};
+
+/**
+ * @brief Scheduler counters from the tail of /proc/stat
+ * Cumulative since boot except the procs_* gauges.
+ */
+struct ProcStatCounters {
+    qint64 contextSwitches;     // "ctxt"
+    qint64 interrupts;          // "intr" total (first column)
+    qint64 softirqs;            // "softirq" total (first column)
+    qint64 processesCreated;    // "processes" (forks since boot)
+    int procsRunning;           // "procs_running" gauge
+    int procsBlocked;           // "procs_blocked" gauge
+    qint64 bootTime;            // "btime" (seconds since epoch)
+
+    ProcStatCounters() : contextSwitches(0), interrupts(0), softirqs(0),
+        processesCreated(0), procsRunning(0), procsBlocked(0), bootTime(0) {}
+};
+
+/**
+ * @brief One interface line of /proc/net/dev
+ * All 16 columns in file order: 8 receive, then 8 transmit counters.
+ * The name is kept inline so a tick over thousands of interfaces
+ * allocates nothing.
+ */
+struct NetDevStat {
+    enum Counter {
+        RxBytes = 0, RxPackets, RxErrors, RxDrops, RxFifo, RxFrame, RxCompressed, RxMulticast,
+        TxBytes, TxPackets, TxErrors, TxDrops, TxFifo, TxCollisions, TxCarrier, TxCompressed,
+        CounterCount
+    };
+    static const int NAME_SIZE = 16;    // IFNAMSIZ, including the NUL
+
+    char name[NAME_SIZE];
+    int nameLength;
+    quint64 counters[CounterCount];
+
+    bool sameName(const NetDevStat& other) const {
+        return nameLength == other.nameLength && memcmp(name, other.name, static_cast<size_t>(nameLength)) == 0;
+    }
+
+    NetDevStat() : nameLength(0), counters() { name[0] = '\0'; }
+};
+
+/**
+ * @brief One block device line of /proc/diskstats
+ * The first 11 counters exist on every kernel; discard (4.18+) and
+ * flush (5.5+) counters read as 0 where the kernel has none. Times are
+ * in milliseconds, sectors are always 512 bytes.
+ */
+struct DiskStat {
+    enum Counter {
+        ReadsCompleted = 0, ReadsMerged, SectorsRead, ReadTimeMs,
+        WritesCompleted, WritesMerged, SectorsWritten, WriteTimeMs,
+        InFlight, IoTimeMs, WeightedIoTimeMs,
+        DiscardsCompleted, DiscardsMerged, SectorsDiscarded, DiscardTimeMs,
+        FlushesCompleted, FlushTimeMs,
+        CounterCount
+    };
+    static const int REQUIRED_COUNTERS = 11;
+    static const int NAME_SIZE = 32;    // DISK_NAME_LEN, including the NUL
+    static const int SECTOR_SIZE = 512;
+
+    unsigned int devMajor;      // Not major/minor: glibc has macros of those names
+    unsigned int devMinor;
+    char name[NAME_SIZE];
+    int nameLength;
+    quint64 counters[CounterCount];
+
+    bool sameDevice(const DiskStat& other) const {
+        return devMajor == other.devMajor && devMinor == other.devMinor;
+    }
+
+    DiskStat() : devMajor(0), devMinor(0), nameLength(0), counters() { name[0] = '\0'; }
+};
+
+/**
+ * @brief Content of /proc/loadavg
+ * "0.20 0.18 0.12 1/80 11206": load averages, then runnable and total
+ * scheduling entities (threads included), then the last PID.
+ */
+struct LoadAvgStat {
+    double load1;
+    double load5;
+    double load15;
+    int runningTasks;
+    int totalTasks;
+
+    LoadAvgStat() : load1(0.0), load5(0.0), load15(0.0), runningTasks(0), totalTasks(0) {}
+};
+
+/**
+ * @brief Fields of /proc/<pid>/stat used for process accounting
+ * Times are in clock ticks (sysconf(_SC_CLK_TCK)), startTime counts
+ * from boot and together with the PID identifies a process across
+ * PID reuse. comm is truncated like the kernel's (15 bytes).
+ */
+struct ProcPidStat {
+    static const int COMM_SIZE = 16;    // TASK_COMM_LEN, including the NUL
+
+    qint32 pid;
+    qint32 parentPid;
+    char state;
+    char comm[COMM_SIZE];
+    int commLength;
+    quint64 userTime;
+    quint64 systemTime;
+    int threadCount;
+    quint64 startTime;
+    quint64 virtualSize;        // Bytes
+    qint64 residentPages;
+
+    ProcPidStat() : pid(0), parentPid(0), state('?'), commLength(0), userTime(0),
+        systemTime(0), threadCount(0), startTime(0), virtualSize(0), residentPages(0) { comm[0] = '\0'; }
+};
+
+/**
+ * @brief Content of /proc/<pid>/statm, all in pages
+ */
+struct ProcPidStatm {
+    qint64 size;
+    qint64 resident;
+    qint64 shared;
+    qint64 text;
+    qint64 data;
+
+    ProcPidStatm() : size(0), resident(0), shared(0), text(0), data(0) {}
+};
+
+/**
+ * @brief One line of /proc/mounts, escapes decoded
+ */
+struct MountEntry {
+    QString device;         // "/dev/sda1", "tmpfs", "server:/export"
+    QString mountPoint;
+    QString fileSystem;
+};
+
+/**
+ * @brief Single-pass parsers working directly on ProcFileReader buffers
+ *
+ * Every parser walks the raw bytes once, converts numbers in place and
+ * writes into caller-owned structures. No QString, no line splitting.
+ */
+class ProcParser
+{
+public:
+    // ===================================================================
+    // MEMORY (/proc/meminfo)
+    // ===================================================================
+
+    /**
+     * @brief Fill every MemoryData field from one /proc/meminfo buffer
+     * Computes usedRAM (total - available) and swapUsed as well.
+     * @param data Raw file content
+     * @param size Content length in bytes
+     * @param memory Output structure (size fields only, status untouched)
+     * @return true if MemTotal was found
+     */
+    static bool parseMemInfo(const char* data, qint64 size, MemoryData& memory);
+
+    // ===================================================================
+    // CPU (/proc/stat)
+    // ===================================================================
+
+    /**
+     * @brief Tokenize /proc/stat into CPU counters and tail counters
+     * Walks the buffer once with std::from_chars, no allocations.
+     * "cpuN" lines land in column slot N; cores missing from the file
+     * (offline) are zeroed. The long "intr" and "softirq" lines are
+     * skipped after their total column.
+     * @param data Raw file content
+     * @param size Content length in bytes
+     * @param total Output for the aggregate "cpu" line
+     * @param cores Output per-core columns, sized by the caller
+     * @param counters Optional output for ctxt/intr/processes/procs_*
+     * @return true if the aggregate line was found
+     */
+    static bool parseCPUStat(const char* data, qint64 size, CPUStat& total,
+                             CPUStatArrays& cores,
+                             ProcStatCounters* counters = nullptr);
+
+    // ===================================================================
+    // NETWORK (/proc/net/dev)
+    // ===================================================================
+
+    /**
+     * @brief Parse every interface line of /proc/net/dev
+     * Skips the two header lines, then reads "name: 16 counters" per
+     * line in file order. The vector is resized to the interface count;
+     * its capacity is kept, so steady-state ticks do not allocate.
+     * @param data Raw file content
+     * @param size Content length in bytes
+     * @param interfaces Output, one entry per interface
+     * @return Number of interfaces parsed
+     */
+    static int parseNetDev(const char* data, qint64 size, std::vector<NetDevStat>& interfaces);
+
+    // ===================================================================
+    // STORAGE (/proc/diskstats, /proc/mounts)
+    // ===================================================================
+
+    /**
+     * @brief Parse every device line of /proc/diskstats
+     * Same buffer discipline as parseNetDev(): one pass, the vector's
+     * capacity is kept across calls.
+     * @param data Raw file content
+     * @param size Content length in bytes
+     * @param devices Output, one entry per device in file order
+     * @return Number of devices parsed
+     */
+    static int parseDiskStats(const char* data, qint64 size, std::vector<DiskStat>& devices);
+
+    /**
+     * @brief Parse /proc/mounts into device, mount point and type
+     * Decodes the octal escapes (\040 for a space). Allocates: meant to
+     * run when the mount table changes, not every tick.
+     * @param data Raw file content
+     * @param size Content length in bytes
+     * @param mounts Output, one entry per mount in file order
+     * @return Number of mounts parsed
+     */
+    static int parseMounts(const char* data, qint64 size, QVector<MountEntry>& mounts);
+
+    // ===================================================================
+    // PROCESSES (/proc/<pid>/stat, /proc/<pid>/statm)
+    // ===================================================================
+
+    /**
+     * @brief Parse /proc/<pid>/stat
+     * The command name may contain spaces and parentheses, so the fields
+     * are located from the last ')' of the line.
+     * @param data Raw file content
+     * @param size Content length in bytes
+     * @param stat Output structure
+     * @return true if every field up to rss was found
+     */
+    static bool parsePidStat(const char* data, qint64 size, ProcPidStat& stat);
+
+    /**
+     * @brief Parse /proc/<pid>/statm
+     * @param data Raw file content
+     * @param size Content length in bytes
+     * @param statm Output structure
+     * @return true if the first six fields were found
+     */
+    static bool parsePidStatm(const char* data, qint64 size, ProcPidStatm& statm);
+
+    // ===================================================================
+    // SYSTEM LOAD (/proc/loadavg, /proc/uptime)
+    // ===================================================================
+
+    /**
+     * @brief Parse the single line of /proc/loadavg
+     * @param data Raw file content
+     * @param size Content length in bytes
+     * @param load Output structure
+     * @return true if all five fields were found
+     */
+    static bool parseLoadAvg(const char* data, qint64 size, LoadAvgStat& load);
+
+    /**
+     * @brief Parse /proc/uptime ("350735.47 234388.90")
+     * @param data Raw file content
+     * @param size Content length in bytes
+     * @param uptimeSeconds Output, seconds since boot
+     * @param idleSeconds Optional output, idle time summed over all CPUs
+     * @return true if the uptime was found
+     */
+    static bool parseUptime(const char* data, qint64 size, double* uptimeSeconds,
+                            double* idleSeconds = nullptr);
+
+    // ===================================================================
+    // COUNTERS
+    // ===================================================================
+
+    /**
+     * @brief Delta of a kernel unsigned long counter across a wrap or reset
+     * unsigned long is 32 bits on 32-bit kernels. For 32-bit counters a
+     * decrease is a wrap when the wrapped delta is below 2^31; anything
+     * else is a reset and yields 0.
+     * @param previous Counter of the previous sample
+     * @param current Counter of this sample
+     * @param wideCounters The kernel counter is 64 bits: any decrease is a reset
+     */
+    static quint64 counterDelta(quint64 previous, quint64 current, bool wideCounters);
+
+private:
+    ProcParser() = delete; // Static class only
+};
+
+#endif // PROCPARSER_H
@@ -0,0 +1,363 @@
+/**
+ * @file procreadbatch.cpp
+ * @brief Batched per-tick reads implementation (io_uring / pread)
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#include "procreadbatch.h"
+
+#include <QDebug>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <sched.h>
+#include <unistd.h>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define PROCREADBATCH_HAVE_IO_URING 1
+#endif
+#endif
+#endif
+
+#if defined(PROCREADBATCH_HAVE_IO_URING)
+
+// ===================================================================
+// RAW IO_URING RING (no liburing dependency)
+// ===================================================================
+
+struct IoUringRing {
+    int fd = -1;
+    unsigned entries = 0;
+
+    void* sqPointer = MAP_FAILED;
+    size_t sqSize = 0;
+    void* cqPointer = MAP_FAILED;
+    size_t cqSize = 0;
+    io_uring_sqe* sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+    size_t sqesSize = 0;
+
+    unsigned* sqTail = nullptr;
+    unsigned* sqMask = nullptr;
+    unsigned* sqArray = nullptr;
+    unsigned* cqHead = nullptr;
+    unsigned* cqTail = nullptr;
+    unsigned* cqMask = nullptr;
+    io_uring_cqe* cqes = nullptr;
+
+    std::vector<iovec> iovecs;
+    std::vector<char> completed;    // Per slot of the current chunk
+
+    ~IoUringRing()
+    {
+        if (sqes != MAP_FAILED) munmap(sqes, sqesSize);
+        if (cqPointer != MAP_FAILED && cqPointer != sqPointer) munmap(cqPointer, cqSize);
+        if (sqPointer != MAP_FAILED) munmap(sqPointer, sqSize);
+        if (fd >= 0) ::close(fd);
+    }
+
+    bool setup(unsigned requested)
+    {
+        io_uring_params params;
+        memset(&params, 0, sizeof(params));
+
+        fd = static_cast<int>(syscall(__NR_io_uring_setup, requested, &params));
+        if (fd < 0) return false;
+        entries = params.sq_entries;
+
+        sqSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cqSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap) {
+            sqSize = cqSize = qMax(sqSize, cqSize);
+        }
+
+        sqPointer = mmap(nullptr, sqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                         fd, IORING_OFF_SQ_RING);
+        if (sqPointer == MAP_FAILED) return false;
+
+        cqPointer = singleMap ? sqPointer
+                              : mmap(nullptr, cqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                     fd, IORING_OFF_CQ_RING);
+        if (cqPointer == MAP_FAILED) return false;
+
+        sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        sqes = static_cast<io_uring_sqe*>(mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE,
+                                               MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES));
+        if (sqes == MAP_FAILED) return false;
+
+        char* sq = static_cast<char*>(sqPointer);
+        sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sqMask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+
+        char* cq = static_cast<char*>(cqPointer);
+        cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cqMask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+        iovecs.resize(entries);
+        completed.resize(entries);
+        return true;
+    }
+
+    // Queue one READV at offset 0, the kernel sees it on the next enter()
+    void prepareRead(int fileFd, char* buffer, size_t length, quint64 userData)
+    {
+        const unsigned tail = *sqTail;
+        const unsigned index = tail & *sqMask;
+
+        iovec& iov = iovecs[index];
+        iov.iov_base = buffer;
+        iov.iov_len = length;
+
+        io_uring_sqe* sqe = &sqes[index];
+        memset(sqe, 0, sizeof(*sqe));
+        sqe->opcode = IORING_OP_READV;
+        sqe->fd = fileFd;
+        sqe->addr = reinterpret_cast<quint64>(&iov);
+        sqe->len = 1;
+        sqe->off = 0;
+        sqe->user_data = userData;
+
+        sqArray[index] = index;
+        __atomic_store_n(sqTail, tail + 1, __ATOMIC_RELEASE);
+    }
+
+    int enter(unsigned toSubmit, unsigned minComplete)
+    {
+        return static_cast<int>(syscall(__NR_io_uring_enter, fd, toSubmit, minComplete,
+                                        IORING_ENTER_GETEVENTS, nullptr, 0));
+    }
+};
+
+#else
+
+struct IoUringRing {};
+
+#endif
+
+// ===================================================================
+// CONSTRUCTION
+// ===================================================================
+
+ProcReadBatch::ProcReadBatch(Backend preferred)
+    : m_backend(preferred)
+    , m_syscallCount(0)
+{
+    if (m_backend == Backend::IoUring && !isIoUringSupported()) {
+        m_backend = Backend::Pread;
+    }
+}
+
+ProcReadBatch::~ProcReadBatch()
+{
+    destroyRing();
+}
+
+void ProcReadBatch::addReader(ProcFileReader *reader)
+{
+    if (!reader) return;
+
+    reader->open();
+    m_readers.push_back(reader);
+}
+
+void ProcReadBatch::clear()
+{
+    m_readers.clear();
+}
+
+// ===================================================================
+// READ OPERATIONS
+// ===================================================================
+
+int ProcReadBatch::readAll()
+{
+    if (m_readers.empty()) {
+        return 0;
+    }
+
+    if (m_backend == Backend::IoUring) {
+        return readAllIoUring();
+    }
+
+    return readAllPread(0, m_readers.size());
+}
+
+int ProcReadBatch::readAllPread(size_t first, size_t last)
+{
+    int valid = 0;
+    for (size_t i = first; i < last; ++i) {
+        ProcFileReader* reader = m_readers[i];
+
+        // Files that failed to open in addReader() stay empty, no retry
+        // (and no warning) every tick
+        if (reader->fd() < 0) {
+            reader->completeRead(-EBADF);
+            continue;
+        }
+
+        ++m_syscallCount;
+        if (reader->read() > 0) {
+            ++valid;
+        }
+    }
+    return valid;
+}
+
+int ProcReadBatch::readAllIoUring()
+{
+#if defined(PROCREADBATCH_HAVE_IO_URING)
+    // A tick of a few hundred files fits one ring; larger sets go in chunks
+    const unsigned wanted = static_cast<unsigned>(qMin<size_t>(m_readers.size(), 256));
+    if (!ensureRing(wanted)) {
+        qWarning() << "io_uring unavailable, falling back to pread";
+        destroyRing();
+        m_backend = Backend::Pread;
+        return readAllPread(0, m_readers.size());
+    }
+
+    IoUringRing& ring = *m_ring;
+    int valid = 0;
+
+    for (size_t first = 0; first < m_readers.size(); first += ring.entries) {
+        const size_t last = qMin(m_readers.size(), first + ring.entries);
+        std::fill(ring.completed.begin(), ring.completed.end(), 0);
+
+        unsigned queued = 0;
+        for (size_t i = first; i < last; ++i) {
+            ProcFileReader* reader = m_readers[i];
+            if (reader->fd() < 0) {
+                reader->completeRead(-EBADF);
+                ring.completed[i - first] = 1;
+                continue;
+            }
+            ring.prepareRead(reader->fd(), reader->buffer(),
+                             static_cast<size_t>(reader->capacity()), i);
+            ++queued;
+        }
+
+        unsigned completed = 0;
+        auto reap = [&] {
+            unsigned head = *ring.cqHead;
+            const unsigned tail = __atomic_load_n(ring.cqTail, __ATOMIC_ACQUIRE);
+            for (; head != tail; ++head, ++completed) {
+                const io_uring_cqe& cqe = ring.cqes[head & *ring.cqMask];
+                const size_t index = static_cast<size_t>(cqe.user_data);
+                ProcFileReader* reader = m_readers[index];
+                ring.completed[index - first] = 1;
+
+                if (!reader->completeRead(cqe.res)) {
+                    // File outgrew the buffer: let read() grow and re-read
+                    ++m_syscallCount;
+                    if (reader->read() > 0) ++valid;
+                } else if (cqe.res > 0) {
+                    ++valid;
+                }
+            }
+            __atomic_store_n(ring.cqHead, head, __ATOMIC_RELEASE);
+        };
+
+        unsigned toSubmit = queued;
+        bool failed = false;
+        while (completed < queued) {
+            ++m_syscallCount;
+            const int result = ring.enter(toSubmit, queued - completed);
+            if (result < 0) {
+                if (errno == EINTR) continue;
+                qWarning() << "io_uring_enter failed:" << strerror(errno) << "- falling back to pread";
+                failed = true;
+                break;
+            }
+            toSubmit -= qMin(toSubmit, static_cast<unsigned>(result));
+            reap();
+        }
+
+        if (failed) {
+            // Reads already punted to io-wq keep writing into the reader
+            // buffers even after the ring is closed: wait for every one
+            // that was submitted before touching those buffers again.
+            // procfs reads always complete, if enter() is broken for good
+            // the CQ ring still fills
+            const unsigned submitted = queued - toSubmit;
+            while (completed < submitted) {
+                ++m_syscallCount;
+                if (ring.enter(0, submitted - completed) < 0 && errno != EINTR) {
+                    sched_yield();
+                }
+                reap();
+            }
+
+            // Only the reads that never completed are repeated
+            for (size_t i = first; i < last; ++i) {
+                if (!ring.completed[i - first]) {
+                    valid += readAllPread(i, i + 1);
+                }
+            }
+            destroyRing();
+            m_backend = Backend::Pread;
+            return valid + readAllPread(last, m_readers.size());
+        }
+    }
+
+    return valid;
+#else
+    m_backend = Backend::Pread;
+    return readAllPread(0, m_readers.size());
+#endif
+}
+
+// ===================================================================
+// RING MANAGEMENT
+// ===================================================================
+
+bool ProcReadBatch::ensureRing(unsigned entries)
+{
+#if defined(PROCREADBATCH_HAVE_IO_URING)
+    if (m_ring && m_ring->entries >= entries) {
+        return true;
+    }
+
+    destroyRing();
+    m_ring = std::make_unique<IoUringRing>();
+    return m_ring->setup(qMax(1u, entries));
+#else
+    Q_UNUSED(entries);
+    return false;
+#endif
+}
+
+void ProcReadBatch::destroyRing()
+{
+    m_ring.reset();
+}
+
+bool ProcReadBatch::isIoUringSupported()
+{
+#if defined(PROCREADBATCH_HAVE_IO_URING)
+    static const bool supported = [] {
+        IoUringRing probe;
+        return probe.setup(1);
+    }();
+    return supported;
+#else
+    return false;
+#endif
+}
+
+const char* ProcReadBatch::backendName(Backend backend)
+{
+    switch (backend) {
+    case Backend::Pread: return "pread";
+    case Backend::IoUring: return "io_uring";
+    }
+    return "unknown";
+}
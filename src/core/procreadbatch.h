@@ -0,0 +1,100 @@
+/**
+ * @file procreadbatch.h
+ * @brief Batched per-tick reads of many /proc and sysfs files
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#ifndef PROCREADBATCH_H
+#define PROCREADBATCH_H
+
+#include <QtGlobal>
+#include <memory>
+#include <vector>
+#include "procfilereader.h"
+
+struct IoUringRing;
+
+/**
+ * @brief Refreshes a set of ProcFileReaders with as few syscalls as possible
+ *
+ * With the io_uring backend every registered file gets one READV
+ * submission entry and the whole set is submitted and reaped with a
+ * single io_uring_enter() call. Without io_uring (old kernel, seccomp,
+ * kernel.io_uring_disabled, no headers at build time) each reader falls
+ * back to its own pread(). Results land in the readers' buffers exactly
+ * as ProcFileReader::read() would leave them.
+ *
+ * Readers are not owned and must outlive the batch or be removed with
+ * clear() first.
+ */
+class ProcReadBatch
+{
+public:
+    enum class Backend {
+        Pread = 0,
+        IoUring
+    };
+
+    /**
+     * @param preferred Backend to use when the system supports it
+     */
+    explicit ProcReadBatch(Backend preferred = Backend::IoUring);
+    ~ProcReadBatch();
+
+    ProcReadBatch(const ProcReadBatch&) = delete;
+    ProcReadBatch& operator=(const ProcReadBatch&) = delete;
+
+    /**
+     * @brief Register a reader, opening its descriptor
+     * @param reader Reader refreshed by readAll()
+     */
+    void addReader(ProcFileReader* reader);
+
+    /**
+     * @brief Forget every registered reader
+     */
+    void clear();
+
+    int readerCount() const { return static_cast<int>(m_readers.size()); }
+
+    /**
+     * @brief Re-read every registered file
+     * @return Number of files that returned data
+     */
+    int readAll();
+
+    /**
+     * @brief Backend actually in use (Pread after an io_uring failure)
+     */
+    Backend backend() const { return m_backend; }
+
+    /**
+     * @brief Syscalls issued by readAll() since the last reset
+     */
+    quint64 syscallCount() const { return m_syscallCount; }
+    void resetSyscallCount() { m_syscallCount = 0; }
+
+    /**
+     * @brief Check once whether io_uring can be set up in this process
+     */
+    static bool isIoUringSupported();
+
+    /**
+     * @brief Human readable backend name ("io_uring", "pread")
+     */
+    static const char* backendName(Backend backend);
+
+private:
+    int readAllPread(size_t first, size_t last);
+    int readAllIoUring();
+    bool ensureRing(unsigned entries);
+    void destroyRing();
+
+    std::vector<ProcFileReader*> m_readers;
+    std::unique_ptr<IoUringRing> m_ring;
+    Backend m_backend;
+    quint64 m_syscallCount;
+};
+
+#endif // PROCREADBATCH_H
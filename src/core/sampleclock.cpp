@@ -0,0 +1,72 @@
+/**
+ * @file sampleclock.cpp
+ * @brief Monotonic sample clock implementation
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#include "sampleclock.h"
+
+#include <ctime>
+
+namespace {
+
+struct SessionAnchor {
+    qint64 monotonicNs;
+    qint64 wallMs;
+
+    SessionAnchor()
+        : monotonicNs(SampleClock::nowNs())
+        , wallMs(QDateTime::currentMSecsSinceEpoch())
+    {
+    }
+};
+
+const SessionAnchor& anchor()
+{
+    static const SessionAnchor sessionAnchor;
+    return sessionAnchor;
+}
+
+} // namespace
+
+qint64 SampleClock::nowNs()
+{
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<qint64>(now.tv_sec) * 1000000000LL + now.tv_nsec;
+}
+
+qint64 SampleClock::threadCpuNs()
+{
+    timespec now;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+    return static_cast<qint64>(now.tv_sec) * 1000000000LL + now.tv_nsec;
+}
+
+qint64 SampleClock::anchorNs()
+{
+    return anchor().monotonicNs;
+}
+
+qint64 SampleClock::anchorWallMs()
+{
+    return anchor().wallMs;
+}
+
+qint64 SampleClock::toWallMs(qint64 monotonicNs)
+{
+    if (monotonicNs <= 0) return 0;
+
+    const SessionAnchor& session = anchor();
+    const qint64 offsetNs = monotonicNs - session.monotonicNs;
+    // Round toward negative infinity so stamps before the anchor work too
+    const qint64 offsetMs = (offsetNs >= 0) ? offsetNs / 1000000 : -((-offsetNs + 999999) / 1000000);
+    return session.wallMs + offsetMs;
+}
+
+QDateTime SampleClock::toDateTime(qint64 monotonicNs)
+{
+    if (monotonicNs <= 0) return QDateTime();
+    return QDateTime::fromMSecsSinceEpoch(toWallMs(monotonicNs));
+}
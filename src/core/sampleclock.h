@@ -0,0 +1,70 @@
+/**
+ * @file sampleclock.h
+ * @brief Monotonic sample timestamps with a per-session wall-clock anchor
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#ifndef SAMPLECLOCK_H
+#define SAMPLECLOCK_H
+
+#include <QtGlobal>
+#include <QDateTime>
+
+/**
+ * @brief CLOCK_MONOTONIC time source for samples and rate math
+ *
+ * Samples are stamped with nowNs(): cheap (vDSO, no timezone work),
+ * never jumps with NTP or manual clock changes, so differences between
+ * two stamps are the real elapsed interval. Wall-clock time is read
+ * once per session as an anchor and derived from it for display.
+ */
+class SampleClock
+{
+public:
+    /**
+     * @brief Current CLOCK_MONOTONIC time in nanoseconds
+     */
+    static qint64 nowNs();
+
+    /**
+     * @brief CPU time consumed by the calling thread (CLOCK_THREAD_CPUTIME_ID)
+     */
+    static qint64 threadCpuNs();
+
+    /**
+     * @brief Monotonic time at which the session anchor was taken
+     */
+    static qint64 anchorNs();
+
+    /**
+     * @brief Wall-clock time (ms since epoch) matching anchorNs()
+     */
+    static qint64 anchorWallMs();
+
+    /**
+     * @brief Convert a monotonic stamp to wall-clock milliseconds
+     * @param monotonicNs Stamp from nowNs()
+     * @return Milliseconds since epoch, 0 for a zero stamp
+     */
+    static qint64 toWallMs(qint64 monotonicNs);
+
+    /**
+     * @brief Convert a monotonic stamp to a local QDateTime for display
+     * @param monotonicNs Stamp from nowNs()
+     * @return Wall-clock time, invalid for a zero stamp
+     */
+    static QDateTime toDateTime(qint64 monotonicNs);
+
+    /**
+     * @brief Elapsed seconds between two stamps (0 if not ordered)
+     */
+    static double secondsBetween(qint64 earlierNs, qint64 laterNs) {
+        return (earlierNs > 0 && laterNs > earlierNs) ? (laterNs - earlierNs) / 1e9 : 0.0;
+    }
+
+private:
+    SampleClock() = delete; // Static class only
+};
+
+#endif // SAMPLECLOCK_H
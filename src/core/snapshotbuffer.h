@@ -0,0 +1,99 @@
+/**
+ * @file snapshotbuffer.h
+ * @brief Lock-free latest-value publication for one writer, many readers
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#ifndef SNAPSHOTBUFFER_H
+#define SNAPSHOTBUFFER_H
+
+#include <QtGlobal>
+#include <atomic>
+#include <thread>
+
+/**
+ * @brief Multi-slot snapshot buffer (single writer, any number of readers)
+ *
+ * The writer fills a slot that is neither current nor pinned by a
+ * reader, then makes it current. A reader pins the current slot with a
+ * per-slot counter, re-checks that it is still current and copies it.
+ * Neither side takes a lock, and a reader never waits for the writer.
+ *
+ * Unlike a seqlock this works for types with owning members (QVector,
+ * QString): a slot is never written while a reader copies it. Copies
+ * of implicitly shared Qt containers only bump a reference count.
+ *
+ * The writer only waits (yields) when every non-current slot is pinned,
+ * which needs Slots - 1 readers copying stale slots at once.
+ */
+template <typename T, int Slots = 4>
+class SnapshotBuffer
+{
+    static_assert(Slots >= 2, "SnapshotBuffer needs at least two slots");
+
+public:
+    SnapshotBuffer() : m_current(0), m_version(0)
+    {
+        for (std::atomic<int>& readers : m_readers) {
+            readers.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Make value the latest snapshot (writer thread only)
+     */
+    void publish(const T& value)
+    {
+        const int current = m_current.load(std::memory_order_relaxed);
+        for (;;) {
+            for (int i = 1; i < Slots; ++i) {
+                const int slot = (current + i) % Slots;
+                if (m_readers[slot].load(std::memory_order_seq_cst) != 0) continue;
+
+                m_slots[slot] = value;
+                m_current.store(slot, std::memory_order_seq_cst);
+                m_version.fetch_add(1, std::memory_order_release);
+                return;
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+     * @brief Copy of the latest snapshot (any thread)
+     * Default-constructed T until the first publish().
+     */
+    T read() const
+    {
+        for (;;) {
+            const int slot = m_current.load(std::memory_order_seq_cst);
+            m_readers[slot].fetch_add(1, std::memory_order_seq_cst);
+
+            // Still current: the writer cannot pick this slot until unpinned
+            if (m_current.load(std::memory_order_seq_cst) == slot) {
+                T copy = m_slots[slot];
+                m_readers[slot].fetch_sub(1, std::memory_order_release);
+                return copy;
+            }
+
+            m_readers[slot].fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    /**
+     * @brief Number of publish() calls so far, cheap change detection
+     */
+    quint64 version() const { return m_version.load(std::memory_order_acquire); }
+
+private:
+    SnapshotBuffer(const SnapshotBuffer&) = delete;
+    SnapshotBuffer& operator=(const SnapshotBuffer&) = delete;
+
+    T m_slots[Slots];
+    mutable std::atomic<int> m_readers[Slots];
+    std::atomic<int> m_current;
+    std::atomic<quint64> m_version;
+};
+
+#endif // SNAPSHOTBUFFER_H
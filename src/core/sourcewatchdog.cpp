@@ -0,0 +1,279 @@
+/**
+ * @file sourcewatchdog.cpp
+ * @brief Deadline-bounded source collection implementation
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#include "sourcewatchdog.h"
+#include "sampleclock.h"
+
+#include <QDebug>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief State shared between a source and its worker thread
+ * Held by shared_ptr on both sides so a detached, hung worker never
+ * outlives it.
+ */
+struct SourceWorker {
+    std::mutex mutex;
+    std::condition_variable wake;       // requested or quit
+    std::condition_variable done;       // finished
+    SourceWatchdog::ReadFunction read;
+    std::thread thread;
+    bool requested = false;
+    bool finished = false;
+    bool result = false;
+    bool quit = false;
+};
+
+namespace {
+
+void runWorker(std::shared_ptr<SourceWorker> worker)
+{
+    std::unique_lock<std::mutex> lock(worker->mutex);
+    for (;;) {
+        worker->wake.wait(lock, [&worker] { return worker->requested || worker->quit; });
+        if (worker->quit) return;
+        worker->requested = false;
+
+        // The only place a read may block, with nothing locked
+        lock.unlock();
+        bool ok = false;
+        try {
+            ok = worker->read();
+        } catch (const std::exception& e) {
+            qWarning() << "Source read failed:" << e.what();
+        }
+        lock.lock();
+
+        worker->result = ok;
+        worker->finished = true;
+        worker->done.notify_all();
+    }
+}
+
+} // namespace
+
+SourceWatchdog::SourceWatchdog()
+    : m_retryMinMs(SOURCE_RETRY_MIN)
+    , m_retryMaxMs(SOURCE_RETRY_MAX)
+{
+}
+
+SourceWatchdog::~SourceWatchdog()
+{
+    for (Source& source : m_sources) {
+        SourceWorker& worker = *source.worker;
+        {
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            worker.quit = true;
+        }
+        worker.wake.notify_all();
+
+        // A worker stuck in the kernel cannot be joined; it exits on its
+        // own once the read returns, keeping the shared state alive
+        if (source.inFlight) {
+            worker.thread.detach();
+        } else {
+            worker.thread.join();
+        }
+    }
+}
+
+// ===================================================================
+// SOURCES
+// ===================================================================
+
+int SourceWatchdog::addSource(const QString &name, ReadFunction read, int timeoutMs)
+{
+    Source source;
+    source.name = name;
+    source.worker = std::make_shared<SourceWorker>();
+    source.worker->read = std::move(read);
+    source.worker->thread = std::thread(runWorker, source.worker);
+    source.timeoutNs = static_cast<qint64>(qMax(1, timeoutMs)) * 1000000LL;
+    source.dispatchNs = 0;
+    source.nextRetryNs = 0;
+    source.retryDelayMs = 0;
+    source.timeouts = 0;
+    source.inFlight = false;
+    source.awaited = false;
+    source.retrying = false;
+    source.fresh = false;
+    source.stale = false;
+    source.succeeded = false;
+
+    m_sources.push_back(std::move(source));
+    return static_cast<int>(m_sources.size()) - 1;
+}
+
+void SourceWatchdog::setRetryBackoff(int minMs, int maxMs)
+{
+    m_retryMinMs = qMax(1, minMs);
+    m_retryMaxMs = qMax(m_retryMinMs, maxMs);
+}
+
+// ===================================================================
+// COLLECTION
+// ===================================================================
+
+int SourceWatchdog::collect()
+{
+    const qint64 nowNs = SampleClock::nowNs();
+
+    for (Source& source : m_sources) {
+        source.fresh = false;
+        source.awaited = false;
+
+        if (source.inFlight) {
+            // Still hung, or a late / background result to pick up
+            bool ok = false;
+            if (takeResult(source, &ok)) {
+                complete(source, ok);
+            }
+            continue;
+        }
+
+        if (source.stale) {
+            if (nowNs < source.nextRetryNs) continue;
+
+            // Background retry: the tick never waits on a source that hung
+            source.retrying = true;
+            source.retryDelayMs = qMin(source.retryDelayMs * 2, m_retryMaxMs);
+            source.nextRetryNs = nowNs + static_cast<qint64>(source.retryDelayMs) * 1000000LL;
+            dispatch(source, nowNs);
+            continue;
+        }
+
+        source.awaited = true;
+        dispatch(source, nowNs);
+    }
+
+    int fresh = 0;
+    for (Source& source : m_sources) {
+        if (source.awaited) {
+            SourceWorker& worker = *source.worker;
+            bool finished;
+            {
+                std::unique_lock<std::mutex> lock(worker.mutex);
+                const qint64 remainingNs = source.dispatchNs + source.timeoutNs - SampleClock::nowNs();
+                finished = worker.done.wait_for(lock, std::chrono::nanoseconds(qMax<qint64>(0, remainingNs)),
+                                                [&worker] { return worker.finished; });
+            }
+
+            bool ok = false;
+            if (finished && takeResult(source, &ok)) {
+                complete(source, ok);
+            } else {
+                // Leave the worker to the kernel, go on without this source
+                source.stale = true;
+                ++source.timeouts;
+                source.retryDelayMs = m_retryMinMs;
+                source.nextRetryNs = SampleClock::nowNs() + static_cast<qint64>(m_retryMinMs) * 1000000LL;
+                qWarning() << "Source" << source.name << "missed its"
+                           << source.timeoutNs / 1000000 << "ms deadline, marked stale";
+            }
+        }
+
+        if (source.fresh) ++fresh;
+    }
+
+    return fresh;
+}
+
+void SourceWatchdog::dispatch(Source &source, qint64 nowNs)
+{
+    SourceWorker& worker = *source.worker;
+    {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.requested = true;
+        worker.finished = false;
+    }
+    worker.wake.notify_one();
+
+    source.inFlight = true;
+    source.dispatchNs = nowNs;
+}
+
+bool SourceWatchdog::takeResult(Source &source, bool *ok)
+{
+    SourceWorker& worker = *source.worker;
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    if (!worker.finished) return false;
+
+    worker.finished = false;
+    *ok = worker.result;
+    return true;
+}
+
+void SourceWatchdog::complete(Source &source, bool ok)
+{
+    const bool wasRetry = source.retrying;
+    source.inFlight = false;
+    source.retrying = false;
+
+    if (source.stale) {
+        // The read that hung finally returned: the worker is free for
+        // the next retry, but only a successful retry recovers the source
+        if (!wasRetry || !ok) return;
+
+        source.stale = false;
+        source.retryDelayMs = 0;
+        qDebug() << "Source" << source.name << "recovered after"
+                 << source.timeouts << "timeouts";
+    }
+
+    source.succeeded = ok;
+    source.fresh = ok;
+}
+
+// ===================================================================
+// STATE
+// ===================================================================
+
+bool SourceWatchdog::isFresh(int source) const
+{
+    return source >= 0 && source < sourceCount() && m_sources[static_cast<size_t>(source)].fresh;
+}
+
+bool SourceWatchdog::isStale(int source) const
+{
+    return source >= 0 && source < sourceCount() && m_sources[static_cast<size_t>(source)].stale;
+}
+
+bool SourceWatchdog::isInFlight(int source) const
+{
+    return source >= 0 && source < sourceCount() && m_sources[static_cast<size_t>(source)].inFlight;
+}
+
+MetricStatus SourceWatchdog::status(int source) const
+{
+    if (source < 0 || source >= sourceCount()) return MetricStatus::Unknown;
+
+    const Source& entry = m_sources[static_cast<size_t>(source)];
+    return (entry.stale || !entry.succeeded) ? MetricStatus::Unknown : MetricStatus::Normal;
+}
+
+QString SourceWatchdog::sourceName(int source) const
+{
+    if (source < 0 || source >= sourceCount()) return QString();
+    return m_sources[static_cast<size_t>(source)].name;
+}
+
+quint64 SourceWatchdog::timeoutCount(int source) const
+{
+    if (source < 0 || source >= sourceCount()) return 0;
+    return m_sources[static_cast<size_t>(source)].timeouts;
+}
+
+int SourceWatchdog::retryDelayMs(int source) const
+{
+    if (source < 0 || source >= sourceCount()) return 0;
+    return m_sources[static_cast<size_t>(source)].retryDelayMs;
+}
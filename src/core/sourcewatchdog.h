@@ -0,0 +1,116 @@
+/**
+ * @file sourcewatchdog.h
+ * @brief Deadline-bounded collection of data sources that may hang
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#ifndef SOURCEWATCHDOG_H
+#define SOURCEWATCHDOG_H
+
+#include <QString>
+#include <QtGlobal>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "constants.h"
+#include "types.h"
+
+struct SourceWorker;
+
+/**
+ * @brief Runs each source read on its own worker thread under a deadline
+ *
+ * A read of a sysfs attribute with a wedged driver, or statvfs() on a
+ * dead NFS mount, can block in the kernel forever and cannot be
+ * cancelled. Each source therefore gets a dedicated worker; collect()
+ * starts every due read at once and waits at most until each source's
+ * deadline. A read that misses it marks the source stale and the tick
+ * goes on without it.
+ *
+ * A stale source's worker stays stuck until the kernel returns. Once it
+ * is free again the source is retried in the background (collect() does
+ * not wait for retries), with exponential backoff from SOURCE_RETRY_MIN
+ * to SOURCE_RETRY_MAX. The first successful read makes it fresh again.
+ *
+ * Ownership rule: whatever a read function touches belongs to the
+ * worker while isInFlight() is true. The collecting thread may use it
+ * only when isFresh() (the read completed) or the source is idle. Read
+ * functions should capture shared_ptr-owned state: on destruction a
+ * hung worker is detached and keeps its captures alive until it returns.
+ *
+ * All methods except the read functions run on one collecting thread.
+ */
+class SourceWatchdog
+{
+public:
+    /**
+     * @brief Source read, true on success
+     * A false return is an ordinary failure (missing file), not a hang.
+     */
+    using ReadFunction = std::function<bool()>;
+
+    SourceWatchdog();
+    ~SourceWatchdog();
+
+    SourceWatchdog(const SourceWatchdog&) = delete;
+    SourceWatchdog& operator=(const SourceWatchdog&) = delete;
+
+    /**
+     * @brief Register a source and start its worker
+     * @param name Label for diagnostics ("thermal", "statvfs /mnt/nfs")
+     * @param read Read function, runs on the worker thread
+     * @param timeoutMs Deadline for one read
+     * @return Source id for the queries below
+     */
+    int addSource(const QString& name, ReadFunction read, int timeoutMs = SOURCE_READ_TIMEOUT);
+
+    /**
+     * @brief Read every due source, wait for healthy ones up to their deadline
+     * @return Number of sources fresh after this call
+     */
+    int collect();
+
+    // Per-source state after the last collect()
+    bool isFresh(int source) const;         // Read completed successfully this tick
+    bool isStale(int source) const;         // Missed a deadline, not recovered yet
+    bool isInFlight(int source) const;      // Worker owns the source's data
+    MetricStatus status(int source) const;  // Unknown while stale or unread
+
+    int sourceCount() const { return static_cast<int>(m_sources.size()); }
+    QString sourceName(int source) const;
+    quint64 timeoutCount(int source) const;
+    int retryDelayMs(int source) const;     // Current backoff, 0 when healthy
+
+    /**
+     * @brief Backoff bounds for retries of stale sources
+     */
+    void setRetryBackoff(int minMs, int maxMs);
+
+private:
+    struct Source {
+        QString name;
+        std::shared_ptr<SourceWorker> worker;
+        qint64 timeoutNs;
+        qint64 dispatchNs;
+        qint64 nextRetryNs;
+        int retryDelayMs;
+        quint64 timeouts;
+        bool inFlight;
+        bool awaited;       // Dispatched by this collect() as a healthy read
+        bool retrying;      // In-flight read is a background retry
+        bool fresh;
+        bool stale;
+        bool succeeded;     // Last completed read returned true
+    };
+
+    void dispatch(Source& source, qint64 nowNs);
+    bool takeResult(Source& source, bool* ok);
+    void complete(Source& source, bool ok);
+
+    std::vector<Source> m_sources;
+    int m_retryMinMs;
+    int m_retryMaxMs;
+};
+
+#endif // SOURCEWATCHDOG_H
@@ -0,0 +1,257 @@
+/**
+ * @file systeminfocache.cpp
+ * @brief Process-wide cache of static system information implementation
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#include "systeminfocache.h"
+#include "constants.h"
+#include "procfilereader.h"
+#include "procparser.h"
+
+#include <QByteArray>
+#include <QFile>
+#include <QHostInfo>
+#include <QMutex>
+#include <QMutexLocker>
+#include <charconv>
+#include <cstring>
+#include <sys/utsname.h>
+#include <unistd.h>
+
+namespace {
+
+struct CacheState {
+    QMutex mutex;
+    SystemInfo info;
+    bool valid = false;
+    quint64 generation = 0;
+    ProcFileReader onlineReader{CPU_SYSFS_PATH + "/online", 256};
+    QByteArray onlineMask;
+};
+
+CacheState& state()
+{
+    static CacheState cacheState;
+    return cacheState;
+}
+
+// Single pass over /proc/cpuinfo. "model name" sits in the first block,
+// so reading stops there on x86; ARM kernels may only print "Hardware"
+// at the very end.
+QString readCPUModel()
+{
+    QFile file(PROC_CPUINFO);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QString();
+    }
+
+    QByteArray hardware;
+    char line[512];
+    qint64 length;
+    while ((length = file.readLine(line, sizeof(line))) > 0) {
+        const char* colon = static_cast<const char*>(memchr(line, ':', static_cast<size_t>(length)));
+        if (!colon) continue;
+
+        if (strncmp(line, "model name", 10) == 0) {
+            return QString::fromLatin1(colon + 1).trimmed();
+        }
+        if (hardware.isEmpty() && strncmp(line, "Hardware", 8) == 0) {
+            hardware = QByteArray(colon + 1).trimmed();
+        }
+    }
+
+    return QString::fromLatin1(hardware);
+}
+
+} // namespace
+
+// ===================================================================
+// CACHED ACCESS
+// ===================================================================
+
+SystemInfo SystemInfoCache::info()
+{
+    CacheState& cache = state();
+    QMutexLocker locker(&cache.mutex);
+
+    if (!cache.valid) {
+        cache.info = collect();
+        cache.valid = true;
+    }
+
+    return cache.info;
+}
+
+QString SystemInfoCache::hostname()
+{
+    return info().hostname;
+}
+
+QString SystemInfoCache::kernelVersion()
+{
+    return info().kernelVersion;
+}
+
+QString SystemInfoCache::cpuModel()
+{
+    return info().cpuModel;
+}
+
+int SystemInfoCache::cpuCoreCount()
+{
+    return info().cpuCoreCount;
+}
+
+QDateTime SystemInfoCache::bootTime()
+{
+    return info().bootTime;
+}
+
+bool SystemInfoCache::is64BitKernel()
+{
+    const QString machine = info().architecture;
+    if (machine == QLatin1String("Unknown")) {
+        // uname() failed: assume the kernel matches this build
+        return sizeof(long) == 8;
+    }
+    return isWideArchitecture(machine);
+}
+
+bool SystemInfoCache::isWideArchitecture(const QString &machine)
+{
+    // x86_64, aarch64, ppc64le, mips64, riscv64, sparc64, loongarch64...
+    return machine.contains(QLatin1String("64")) ||
+           machine == QLatin1String("s390x") ||
+           machine == QLatin1String("alpha");
+}
+
+// ===================================================================
+// INVALIDATION
+// ===================================================================
+
+bool SystemInfoCache::checkHotplug()
+{
+    CacheState& cache = state();
+    QMutexLocker locker(&cache.mutex);
+
+    if (cache.onlineReader.read() <= 0) {
+        return false;
+    }
+
+    const QByteArray mask(cache.onlineReader.data(), static_cast<int>(cache.onlineReader.size()));
+    if (cache.onlineMask.isEmpty()) {
+        // First check only records the baseline
+        cache.onlineMask = mask;
+        return false;
+    }
+    if (mask == cache.onlineMask) {
+        return false;
+    }
+
+    cache.onlineMask = mask;
+    cache.valid = false;
+    ++cache.generation;
+    return true;
+}
+
+void SystemInfoCache::invalidate()
+{
+    CacheState& cache = state();
+    QMutexLocker locker(&cache.mutex);
+    cache.valid = false;
+    ++cache.generation;
+}
+
+quint64 SystemInfoCache::generation()
+{
+    CacheState& cache = state();
+    QMutexLocker locker(&cache.mutex);
+    return cache.generation;
+}
+
+// ===================================================================
+// COLLECTION
+// ===================================================================
+
+SystemInfo SystemInfoCache::collect()
+{
+    SystemInfo info;
+
+    struct utsname name;
+    if (uname(&name) == 0) {
+        info.hostname = QString::fromLatin1(name.nodename);
+        info.kernelVersion = QString::fromLatin1(name.release);
+        info.architecture = QString::fromLatin1(name.machine);
+    }
+    if (info.hostname.isEmpty()) {
+        info.hostname = QHostInfo::localHostName();
+    }
+    if (info.hostname.isEmpty()) {
+        info.hostname = "Unknown";
+    }
+    if (info.kernelVersion.isEmpty()) {
+        info.kernelVersion = "Unknown";
+    }
+    if (info.architecture.isEmpty()) {
+        info.architecture = "Unknown";
+    }
+
+    // Boot time does not move, derive it from the uptime once instead of
+    // on every query
+    ProcFileReader uptimeReader(PROC_UPTIME, 128);
+    double uptimeSeconds = 0.0;
+    if (uptimeReader.read() > 0 &&
+        ProcParser::parseUptime(uptimeReader.data(), uptimeReader.size(), &uptimeSeconds)) {
+        info.bootTime = QDateTime::fromMSecsSinceEpoch(
+            QDateTime::currentMSecsSinceEpoch() - static_cast<qint64>(uptimeSeconds * 1000.0));
+    }
+
+    info.cpuModel = readCPUModel();
+    if (info.cpuModel.isEmpty()) {
+        // Fallback for pi 3B+
+        info.cpuModel = "ARM Cortex-A53";
+    }
+
+    // Configured CPUs, including offline ones, so /proc/stat cpuN
+    // indices always fit
+    const long configured = sysconf(_SC_NPROCESSORS_CONF);
+    info.cpuCoreCount = (configured > 0) ? static_cast<int>(configured) : 4;
+
+    ProcFileReader online(CPU_SYSFS_PATH + "/online", 256);
+    info.onlineCoreCount = (online.read() > 0) ? countCPUList(online.data()) : 0;
+    if (info.onlineCoreCount <= 0) {
+        info.onlineCoreCount = info.cpuCoreCount;
+    }
+
+    return info;
+}
+
+int SystemInfoCache::countCPUList(const char *cpuList)
+{
+    if (!cpuList) return 0;
+
+    const char* p = cpuList;
+    const char* end = cpuList + strlen(cpuList);
+    int count = 0;
+
+    while (p < end && *p != '\n') {
+        unsigned int first = 0;
+        std::from_chars_result result = std::from_chars(p, end, first);
+        if (result.ec != std::errc()) return 0;
+        p = result.ptr;
+
+        unsigned int last = first;
+        if (p < end && *p == '-') {
+            result = std::from_chars(p + 1, end, last);
+            if (result.ec != std::errc() || last < first) return 0;
+            p = result.ptr;
+        }
+        count += static_cast<int>(last - first + 1);
+
+        if (p < end && *p == ',') ++p;
+    }
+
+    return count;
+}
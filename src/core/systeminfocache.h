@@ -0,0 +1,103 @@
+/**
+ * @file systeminfocache.h
+ * @brief Process-wide cache of static system information
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#ifndef SYSTEMINFOCACHE_H
+#define SYSTEMINFOCACHE_H
+
+#include <QDateTime>
+#include <QString>
+#include <QtGlobal>
+
+/**
+ * @brief Static system facts collected once per hotplug generation
+ */
+struct SystemInfo {
+    QString hostname;       // uname() nodename
+    QString kernelVersion;  // uname() release
+    QString architecture;   // uname() machine ("armv7l" on a Pi 3B+)
+    QDateTime bootTime;     // Wall clock minus /proc/uptime at collection
+    QString cpuModel;       // "model name" (or "Hardware" on ARM)
+    int cpuCoreCount;       // Configured CPUs (cpuN slots in /proc/stat)
+    int onlineCoreCount;    // CPUs listed in cpu/online
+
+    // Constructor
+    SystemInfo() : cpuCoreCount(0), onlineCoreCount(0) {}
+};
+
+/**
+ * @brief Collects hostname, kernel and CPU facts once and serves copies
+ *
+ * The values never change while the system runs except across CPU
+ * hotplug, so the cache stays valid until checkHotplug() sees
+ * /sys/devices/system/cpu/online change. Each invalidation bumps
+ * generation(), which monitors compare to know when to re-discover
+ * per-core resources. Thread-safe.
+ */
+class SystemInfoCache
+{
+public:
+    /**
+     * @brief Cached system information, collected on first use
+     */
+    static SystemInfo info();
+
+    // Shortcuts for the individual fields
+    static QString hostname();
+    static QString kernelVersion();
+    static QString cpuModel();
+    static QDateTime bootTime();
+    static int cpuCoreCount();
+
+    /**
+     * @brief Whether the kernel's unsigned long is 64 bits
+     * Judged from the uname() machine, not from this build, so a 32-bit
+     * userland on a 64-bit kernel (armhf on aarch64) still gets it right.
+     */
+    static bool is64BitKernel();
+
+    /**
+     * @brief Whether a uname() machine names a 64-bit architecture
+     * @param machine "x86_64", "aarch64", "armv7l", ...
+     * @return false for 32-bit and unrecognised names
+     */
+    static bool isWideArchitecture(const QString& machine);
+
+    /**
+     * @brief Re-read the cpu/online mask and invalidate on change
+     * One small pread on a persistent descriptor, cheap enough per tick.
+     * @return true if the CPU set changed since the last check
+     */
+    static bool checkHotplug();
+
+    /**
+     * @brief Drop the cached values and bump the generation
+     */
+    static void invalidate();
+
+    /**
+     * @brief Counter incremented on every invalidation
+     */
+    static quint64 generation();
+
+    /**
+     * @brief Collect fresh values, bypassing the cache
+     * @return Uncached system information
+     */
+    static SystemInfo collect();
+
+    /**
+     * @brief Count CPUs in a sysfs cpu list ("0-3,5,7-8")
+     * @param cpuList List content
+     * @return Number of CPUs, 0 if empty or malformed
+     */
+    static int countCPUList(const char* cpuList);
+
+private:
+    SystemInfoCache() = delete; // Static class only
+};
+
+#endif // SYSTEMINFOCACHE_H
@@ -7,16 +7,33 @@
 
 #include "systemutils.h"
 #include "constants.h"
+#include "procfilereader.h"
+#include "procparser.h"
+#include "systeminfocache.h"
 
 #include <QFile>
 #include <QTextStream>
 #include <QRegularExpression>
-#include <QHostInfo>
 #include <QStorageInfo>
 #include <QDebug>
 #include <QDir>
 #include <QProcess>
 
+namespace {
+
+// One-shot /proc/meminfo snapshot for the get*Memory() helpers
+MemoryData readMemInfo()
+{
+    MemoryData memory;
+    ProcFileReader reader(PROC_MEMINFO, 8192);
+    if (reader.read() > 0) {
+        ProcParser::parseMemInfo(reader.data(), reader.size(), memory);
+    }
+    return memory;
+}
+
+} // namespace
+
 // ===================================================================
 // FILE I/O OPERATIONS
 // ===================================================================
@@ -95,53 +112,23 @@ qint64 SystemUtils::parseInt64(const QString &str, bool *ok)
 
 QString SystemUtils::getHostname()
 {
-    // Try readng from /proc/sys/kernel/host/first
-    QString hostname = readFile("/proc/sys/kernel/hostname");
-
-    if (hostname.isEmpty()) {
-        // Fallback to QHostInfo
-        hostname = QHostInfo::localHostName();
-    }
-
-    return hostname.isEmpty() ? "Unknown" : hostname;
+    // uname() nodename, collected once
+    return SystemInfoCache::hostname();
 }
 
 QString SystemUtils::getKernelVersion()
 {
-    QString version = readFile(PROC_VERSION);
-    if (version.isEmpty()) {
-        return "Unknown";
-    }
-
-    // Parse kernel version from /proc/version
-    // Format: "Linux version 5.10.x-xxx...""
-    QRegularExpression regex("Linux version ([\\d\\.\\-\\w]+)");
-    QRegularExpressionMatch match = regex.match(version);
-
-    if (match.hasMatch()) {
-        return match.captured(1);
-    }
-
-    return "Unknown";
+    // uname() release, collected once
+    return SystemInfoCache::kernelVersion();
 }
 
 QString SystemUtils::getUptime()
 {
-    QString uptimeStr = readFile(PROC_UPTIME);
-    if (uptimeStr.isEmpty()) {
-        return "Unknown";
-    }
-
-    // /proc/uptime format: "12345.67 8901.23"
-    // First number is total uptime inn seconds
-    QStringList parts = uptimeStr.split(' ');
-    if (parts.isEmpty()) {
-        return "Unknown";
-    }
-
-    bool ok;
-    double uptimeSeconds = parseDouble(parts[0], &ok);
-    if (!ok) {
+    // /proc/uptime format: "12345.67 8901.23", total uptime first
+    ProcFileReader reader(PROC_UPTIME, 128);
+    double uptimeSeconds = 0.0;
+    if (reader.read() <= 0 ||
+        !ProcParser::parseUptime(reader.data(), reader.size(), &uptimeSeconds)) {
         return "Unknown";
     }
 
@@ -150,24 +137,8 @@ QString SystemUtils::getUptime()
 
 QDateTime SystemUtils::getBootTime()
 {
-    QString uptimeStr = readFile(PROC_UPTIME);
-    if (uptimeStr.isEmpty()) {
-        return QDateTime();
-    }
-
-    QStringList parts = uptimeStr.split(' ');
-    if (parts.isEmpty()) {
-        return QDateTime();
-    }
-
-    bool ok;
-    double uptimeSeconds = parseDouble(parts[0], &ok);
-    if (!ok) {
-        return QDateTime();
-    }
-
-    // Boot time = current time - up time
-    return QDateTime::currentDateTime().addSecs(-static_cast<qint64>(uptimeSeconds));
+    // Derived from /proc/uptime once, collected with the other static facts
+    return SystemInfoCache::bootTime();
 }
 
 // ===================================================================
@@ -176,34 +147,13 @@ QDateTime SystemUtils::getBootTime()
 
 int SystemUtils::getCPUCoreCount()
 {
-    QStringList lines = readFileLines(PROC_CPUINFO);
-    int coreCount = 0;
-
-    for (const QString &line : lines) {
-        if (line.startsWith("processor")) {
-            coreCount++;
-        }
-    }
-
-    // Pi 3B+ should have 4 core, fallback if detection fails
-    return (coreCount > 0) ? coreCount : 4;
+    // Cached until CPU hotplug, see SystemInfoCache::checkHotplug()
+    return SystemInfoCache::cpuCoreCount();
 }
 
 QString SystemUtils::getCPUModel()
 {
-    QString model = extractValueFromProcFile(PROC_CPUINFO, "model name");
-
-    if (model.isEmpty()) {
-        // Try "Hardware" field for ARM processors
-        model = extractValueFromProcFile(PROC_CPUINFO, "Hardware");
-    }
-
-    if (model.isEmpty()) {
-        // Fallback for pi 3B+
-        model = "ARM Cortex-A53";
-    }
-
-    return model;
+    return SystemInfoCache::cpuModel();
 }
 
 double SystemUtils::getCPUFrequency()
@@ -254,32 +204,27 @@ double SystemUtils::getCPUTemperature()
 
 qint64 SystemUtils::getTotalMemory()
 {
-    QString value = extractValueFromProcFile(PROC_MEMINFO, "MemTotal");
-    return parseMemoryLine("MemTotal: " + value);
+    return readMemInfo().totalRAM;
 }
 
 qint64 SystemUtils::getAvailableMemory()
 {
-    QString value = extractValueFromProcFile(PROC_MEMINFO, "MemAvailable");
-    return parseMemoryLine("MemAvailable: " + value);
+    return readMemInfo().availableRAM;
 }
 
 qint64 SystemUtils::getFreeMemory()
 {
-    QString value = extractValueFromProcFile(PROC_MEMINFO, "MemFree");
-    return parseMemoryLine("MemFree: " + value);
+    return readMemInfo().freeRAM;
 }
 
 qint64 SystemUtils::getBufferMemory()
 {
-    QString value = extractValueFromProcFile(PROC_MEMINFO, "Buffers");
-    return parseMemoryLine("Buffers: " + value);
+    return readMemInfo().buffers;
 }
 
 qint64 SystemUtils::getCacheMemory()
 {
-    QString value = extractValueFromProcFile(PROC_MEMINFO, "Cached");
-    return parseMemoryLine("Cached: " + value);
+    return readMemInfo().cached;
 }
 
 // ===================================================================
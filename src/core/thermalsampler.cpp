@@ -0,0 +1,231 @@
+/**
+ * @file thermalsampler.cpp
+ * @brief Thermal zone / hwmon sampler implementation
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#include "thermalsampler.h"
+#include "systemutils.h"
+
+#include <QDir>
+#include <QDebug>
+#include <algorithm>
+
+namespace {
+
+// Directory entries sorted by their numeric suffix (zone2 before zone10)
+QStringList numericEntries(const QString& root, const QString& prefix, QDir::Filters filters)
+{
+    QStringList entries = QDir(root).entryList(QStringList() << prefix + "*", filters);
+    std::sort(entries.begin(), entries.end(), [&prefix](const QString& a, const QString& b) {
+        return a.mid(prefix.size()).toInt() < b.mid(prefix.size()).toInt();
+    });
+    return entries;
+}
+
+bool isPackageLabel(const QString& label)
+{
+    return label.contains("pkg", Qt::CaseInsensitive) ||
+           label.contains("Package", Qt::CaseInsensitive) ||
+           label.contains("Tctl") || label.contains("Tdie") ||
+           label.startsWith("cpu", Qt::CaseInsensitive);
+}
+
+// Key of a (physical package, core id) pair
+quint64 coreKey(int packageId, int coreId)
+{
+    return (static_cast<quint64>(static_cast<quint32>(packageId)) << 32) | static_cast<quint32>(coreId);
+}
+
+} // namespace
+
+ThermalSampler::ThermalSampler()
+    : m_packageIndex(-1)
+    , m_cpuTemperature(0.0)
+    , m_maxTemperature(0.0)
+{
+}
+
+int ThermalSampler::discover(const QString &thermalRoot, const QString &hwmonRoot,
+                             const QString &cpuRoot)
+{
+    m_readers.clear();
+    m_zones.clear();
+    m_packageIndex = -1;
+    QHash<quint64, int> coreSensors;
+
+    // Thermal zones, labelled by their type
+    for (const QString& zone : numericEntries(thermalRoot, "thermal_zone", QDir::Dirs | QDir::NoDotAndDotDot)) {
+        const QString dir = thermalRoot + "/" + zone;
+        QString type = SystemUtils::readFile(dir + "/type");
+        if (type.isEmpty()) type = zone;
+        addSensor(type, dir + "/temp", isCPUSensorName(type));
+    }
+
+    // hwmon inputs, labelled "<driver> <label>"
+    for (const QString& hwmon : numericEntries(hwmonRoot, "hwmon", QDir::Dirs | QDir::NoDotAndDotDot)) {
+        const QString dir = hwmonRoot + "/" + hwmon;
+        QString name = SystemUtils::readFile(dir + "/name");
+        if (name.isEmpty()) name = hwmon;
+        const bool isCPU = isCPUSensorName(name);
+
+        QStringList inputs = QDir(dir).entryList(QStringList() << "temp*_input", QDir::Files);
+        std::sort(inputs.begin(), inputs.end(), [](const QString& a, const QString& b) {
+            return a.mid(4).section('_', 0, 0).toInt() < b.mid(4).section('_', 0, 0).toInt();
+        });
+
+        // coretemp: one hwmon per package, labelled "Package id P" and "Core N"
+        int packageId = 0;
+        QVector<QPair<int, int>> cores;   // Core id, zone index
+
+        for (const QString& input : inputs) {
+            const QString sensor = input.left(input.size() - QString("_input").size());
+            QString label = SystemUtils::fileExists(dir + "/" + sensor + "_label")
+                                ? SystemUtils::readFile(dir + "/" + sensor + "_label")
+                                : sensor;
+            const int index = m_zones.size();
+            if (!addSensor(name + " " + label, dir + "/" + input, isCPU)) continue;
+
+            bool ok = false;
+            if (label.startsWith("Package id ")) {
+                const int id = label.mid(11).toInt(&ok);
+                if (ok) packageId = id;
+            } else if (isCPU && label.startsWith("Core ")) {
+                const int id = label.mid(5).toInt(&ok);
+                if (ok) cores.append(qMakePair(id, index));
+            }
+        }
+        for (const auto& core : cores) {
+            coreSensors.insert(coreKey(packageId, core.first), core.second);
+        }
+    }
+
+    // Package-level CPU sensor, else first CPU sensor, else first zone
+    for (int i = 0; i < m_zones.size() && m_packageIndex < 0; ++i) {
+        if (m_zones[i].isCPUSensor && isPackageLabel(m_zones[i].label)) m_packageIndex = i;
+    }
+    for (int i = 0; i < m_zones.size() && m_packageIndex < 0; ++i) {
+        if (m_zones[i].isCPUSensor) m_packageIndex = i;
+    }
+    if (m_packageIndex < 0 && !m_zones.isEmpty()) {
+        m_packageIndex = 0;
+    }
+
+    mapCoreSensors(cpuRoot, coreSensors);
+    return m_zones.size();
+}
+
+int ThermalSampler::sample()
+{
+    for (const auto& reader : m_readers) {
+        reader->read();
+    }
+    return update();
+}
+
+void ThermalSampler::addReaders(ProcReadBatch &batch)
+{
+    for (const auto& reader : m_readers) {
+        batch.addReader(reader.get());
+    }
+}
+
+int ThermalSampler::update()
+{
+    bool haveCPUSensor = false;
+    double maxCPU = 0.0;
+    double maxAny = 0.0;
+    int valid = 0;
+
+    for (int i = 0; i < m_zones.size(); ++i) {
+        ThermalZoneData& zone = m_zones[i];
+        qint64 tempMilliC = 0;
+
+        if (!m_readers[static_cast<size_t>(i)]->toInt64(&tempMilliC) ||
+            !SystemUtils::isValidTemperature(tempMilliC / 1000.0)) {
+            zone.temperature = 0.0;
+            zone.status = MetricStatus::Unknown;
+            continue;
+        }
+
+        // Convert milliCelsius to Celsius
+        zone.temperature = tempMilliC / 1000.0;
+        if (zone.temperature >= TEMP_CRITICAL_THRESHOLD) {
+            zone.status = MetricStatus::Critical;
+        } else if (zone.temperature >= TEMP_WARNING_THRESHOLD) {
+            zone.status = MetricStatus::Warning;
+        } else {
+            zone.status = MetricStatus::Normal;
+        }
+
+        maxAny = valid > 0 ? qMax(maxAny, zone.temperature) : zone.temperature;
+        if (zone.isCPUSensor) {
+            maxCPU = haveCPUSensor ? qMax(maxCPU, zone.temperature) : zone.temperature;
+            haveCPUSensor = true;
+        }
+        ++valid;
+    }
+
+    m_cpuTemperature = (m_packageIndex >= 0) ? m_zones[m_packageIndex].temperature : 0.0;
+    m_maxTemperature = haveCPUSensor ? maxCPU : maxAny;
+
+    // A core without a readable sensor reports the package value
+    for (int cpu = 0; cpu < m_coreSensors.size(); ++cpu) {
+        const int index = m_coreSensors[cpu];
+        m_coreTemperatures[cpu] = (index >= 0 && m_zones[index].status != MetricStatus::Unknown)
+            ? m_zones[index].temperature : m_cpuTemperature;
+    }
+    return valid;
+}
+
+bool ThermalSampler::isCPUSensorName(const QString &name)
+{
+    static const QStringList cpuNames = {
+        "x86_pkg_temp", "coretemp", "k10temp", "k8temp", "zenpower",
+        "soc_thermal", "soc-thermal"
+    };
+
+    // Covers cpu-thermal / cpu_thermal (Raspberry Pi) and cpuN-thermal
+    return cpuNames.contains(name) || name.startsWith("cpu", Qt::CaseInsensitive);
+}
+
+bool ThermalSampler::addSensor(const QString &label, const QString &path, bool isCPUSensor)
+{
+    auto reader = std::make_unique<ProcFileReader>(path, 64);
+    if (!reader->open()) {
+        return false;
+    }
+
+    ThermalZoneData zone;
+    zone.label = label;
+    zone.path = path;
+    zone.isCPUSensor = isCPUSensor;
+
+    m_readers.push_back(std::move(reader));
+    m_zones.append(zone);
+    return true;
+}
+
+void ThermalSampler::mapCoreSensors(const QString &cpuRoot, const QHash<quint64, int> &coreSensors)
+{
+    m_coreSensors.clear();
+
+    // cpuN directories only, not cpufreq / cpuidle
+    QStringList cpus = QDir(cpuRoot).entryList(QStringList() << "cpu*", QDir::Dirs | QDir::NoDotAndDotDot);
+    for (const QString& cpu : cpus) {
+        bool ok = false;
+        const int id = cpu.mid(3).toInt(&ok);
+        if (!ok || id < 0) continue;
+        while (m_coreSensors.size() <= id) m_coreSensors.append(-1);
+
+        // Offline CPUs have no topology directory
+        const QString topology = cpuRoot + "/" + cpu + "/topology/";
+        const QString coreId = SystemUtils::readFile(topology + "core_id");
+        if (coreId.isEmpty() || coreSensors.isEmpty()) continue;
+        const int packageId = SystemUtils::readFile(topology + "physical_package_id").toInt();
+        m_coreSensors[id] = coreSensors.value(coreKey(packageId, coreId.toInt()), -1);
+    }
+
+    m_coreTemperatures.fill(0.0, m_coreSensors.size());
+}
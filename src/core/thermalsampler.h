@@ -0,0 +1,93 @@
+/**
+ * @file thermalsampler.h
+ * @brief Thermal zone / hwmon discovery and batched temperature sampler
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#ifndef THERMALSAMPLER_H
+#define THERMALSAMPLER_H
+
+#include <QHash>
+#include <QString>
+#include <QVector>
+#include <memory>
+#include <vector>
+#include "constants.h"
+#include "types.h"
+#include "procfilereader.h"
+#include "procreadbatch.h"
+
+/**
+ * @brief Discovers every temperature sensor once, then reads them all per tick
+ *
+ * Sources are /sys/class/thermal/thermal_zone*\/temp (labelled by their
+ * "type") and /sys/class/hwmon/hwmon*\/temp*_input (labelled
+ * "<name> <tempN_label>"). Sensors are classified as CPU sensors by
+ * driver/type name so the reported CPU temperature no longer depends on
+ * zone0 happening to be the CPU (on x86 servers it is often ACPI).
+ * coretemp "Core N" inputs are mapped to the logical CPUs whose topology
+ * names that core; CPUs without one report the package temperature.
+ */
+class ThermalSampler
+{
+public:
+    ThermalSampler();
+
+    /**
+     * @brief Enumerate thermal zones and hwmon inputs, open their files
+     * @param thermalRoot Thermal class directory
+     * @param hwmonRoot Hwmon class directory
+     * @param cpuRoot CPU sysfs directory, for the core topology
+     * @return Number of sensors found
+     */
+    int discover(const QString& thermalRoot = THERMAL_CLASS_PATH,
+                 const QString& hwmonRoot = HWMON_CLASS_PATH,
+                 const QString& cpuRoot = CPU_SYSFS_PATH);
+
+    /**
+     * @brief Read every discovered sensor, then update()
+     * @return Number of sensors with a valid reading
+     */
+    int sample();
+
+    /**
+     * @brief Register the sensor files with a per-tick batch
+     * Call update() after the batch's readAll() instead of sample().
+     */
+    void addReaders(ProcReadBatch& batch);
+
+    /**
+     * @brief Recompute zone readings from the readers' last content
+     * @return Number of sensors with a valid reading
+     */
+    int update();
+
+    // Results of the last sample
+    const QVector<ThermalZoneData>& zones() const { return m_zones; }
+    double cpuTemperature() const { return m_cpuTemperature; }
+    double maxTemperature() const { return m_maxTemperature; }
+    // Per logical CPU, the package value where a core has no sensor
+    const QVector<double>& coreTemperatures() const { return m_coreTemperatures; }
+
+    /**
+     * @brief Check if a zone type / hwmon name belongs to the CPU
+     * @param name Thermal zone type or hwmon driver name
+     * @return true for x86_pkg_temp, coretemp, k10temp, cpu-thermal, ...
+     */
+    static bool isCPUSensorName(const QString& name);
+
+private:
+    bool addSensor(const QString& label, const QString& path, bool isCPUSensor);
+    void mapCoreSensors(const QString& cpuRoot, const QHash<quint64, int>& coreSensors);
+
+    std::vector<std::unique_ptr<ProcFileReader>> m_readers;
+    QVector<ThermalZoneData> m_zones;
+    QVector<int> m_coreSensors;        // Zone index per logical CPU, -1 if none
+    QVector<double> m_coreTemperatures;
+    int m_packageIndex;
+    double m_cpuTemperature;
+    double m_maxTemperature;
+};
+
+#endif // THERMALSAMPLER_H
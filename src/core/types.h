@@ -13,6 +13,7 @@
 #include <QMetaType>
 #include <QDebug>
 #include <QVector>
+#include "sampleclock.h"
 
 /**
  * @brief System metric status level
@@ -46,6 +47,24 @@ enum class AlertSeverity {
     Emergency       // Emergency system alerts
 };
 
+/**
+ * @brief CPU time split by /proc/stat category (percent of interval)
+ */
+struct CPUTimeBreakdown {
+    double user;            // Normal user processes
+    double nice;            // Niced user processes
+    double system;          // Kernel code
+    double idle;            // Idle
+    double iowait;          // Idle waiting for I/O
+    double irq;             // Hard interrupts
+    double softirq;         // Soft interrupts
+    double steal;           // Stolen by the hypervisor
+
+    // Constructor
+    CPUTimeBreakdown() : user(0.0), nice(0.0), system(0.0), idle(0.0),
+        iowait(0.0), irq(0.0), softirq(0.0), steal(0.0) {}
+};
+
 /**
  * @brief CPU core information structure
  */
@@ -54,6 +73,7 @@ struct CPUCoreData {
     double usage;           // Usage percentage (0.0-100.0)
     double frequency;       // Current frequency in MHz
     double temperature;     // Core temperature in Celsius
+    CPUTimeBreakdown breakdown; // Per-category time split
 
     // Constructor
     CPUCoreData() : coreID(-1), usage(0.0), frequency(0.0), temperature(0.0) {}
@@ -64,6 +84,20 @@ struct CPUCoreData {
     }
 };
 
+/**
+ * @brief One temperature sensor (thermal zone or hwmon input)
+ */
+struct ThermalZoneData {
+    QString label;          // "x86_pkg_temp", "coretemp Package id 0", ...
+    QString path;           // sysfs temperature file
+    double temperature;     // Temperature in Celsius
+    bool isCPUSensor;       // Sensor measures the CPU package or cores
+    MetricStatus status;    // Threshold status, Unknown if unreadable
+
+    // Constructor
+    ThermalZoneData() : temperature(0.0), isCPUSensor(false), status(MetricStatus::Unknown) {}
+};
+
 /**
  * @brief Complete CPU monitoring data
  */
@@ -71,17 +105,32 @@ struct CPUData {
     double totalUsage;              // Overall CPU usage percentage
     double averageFrequency;        // Average frequency across all cores
     double temperature;             // CPU temperature (°C)
+    double maxTemperature;          // Hottest CPU sensor (°C)
     int coreCount;                  // Number of CPU cores
     QString model;                  // CPU model name
     QVector<CPUCoreData> cores;     // Per-core data
+    CPUTimeBreakdown breakdown;     // Overall per-category time split
+    QVector<ThermalZoneData> thermalZones; // All discovered sensors
+    double contextSwitchRate;       // Context switches per second
+    double interruptRate;           // Interrupts per second
+    double softirqRate;             // Softirqs per second
+    double forkRate;                // Processes created per second
+    int procsRunning;               // Runnable tasks (run-queue depth)
+    int procsBlocked;               // Tasks blocked on I/O
+    MetricStatus temperatureStatus; // Unknown while the thermal source is stale
+    MetricStatus frequencyStatus;   // Unknown while the cpufreq source is stale
     MetricStatus status;            // Current status
-    QDateTime timestamp;            // Data collection time
+    qint64 timestampNs;             // Sample time (SampleClock, monotonic)
 
     // Constructor
     CPUData() : totalUsage(0.0), averageFrequency(0.0), temperature(0.0),
-        coreCount(0), status(MetricStatus::Unknown) {
-        timestamp = QDateTime::currentDateTime();
-    }
+        maxTemperature(0.0), coreCount(0), contextSwitchRate(0.0), interruptRate(0.0),
+        softirqRate(0.0), forkRate(0.0), procsRunning(0), procsBlocked(0),
+        temperatureStatus(MetricStatus::Unknown), frequencyStatus(MetricStatus::Unknown),
+        status(MetricStatus::Unknown), timestampNs(0) {}
+
+    // Wall-clock sample time for display
+    QDateTime timestamp() const { return SampleClock::toDateTime(timestampNs); }
 
     // Validation
     bool isValid() const {
@@ -105,18 +154,25 @@ struct MemoryData {
     qint64 cached;              ///< Cache memory in bytes
     qint64 swapTotal;           ///< Total swap in bytes
     qint64 swapUsed;            ///< Used swap in bytes
+    qint64 shmem;               ///< Shared memory (tmpfs, shm) in bytes
+    qint64 sReclaimable;        ///< Reclaimable slab in bytes
+    qint64 dirty;               ///< Dirty page cache in bytes
+    qint64 writeback;           ///< Memory under writeback in bytes
+    qint64 committedAS;         ///< Committed address space in bytes
     double usagePercentage;     ///< RAM usage percentage
     double swapPercentage;      ///< Swap usage percentage
     MetricStatus status;        ///< Current status
-    QDateTime timestamp;        ///< Data collection time
+    qint64 timestampNs;         ///< Sample time (SampleClock, monotonic)
 
     // Constructor
     MemoryData() : totalRAM(0), usedRAM(0), freeRAM(0), availableRAM(0),
         buffers(0), cached(0), swapTotal(0), swapUsed(0),
+        shmem(0), sReclaimable(0), dirty(0), writeback(0), committedAS(0),
         usagePercentage(0.0), swapPercentage(0.0),
-        status(MetricStatus::Unknown) {
-        timestamp = QDateTime::currentDateTime();
-    }
+        status(MetricStatus::Unknown), timestampNs(0) {}
+
+    // Wall-clock sample time for display
+    QDateTime timestamp() const { return SampleClock::toDateTime(timestampNs); }
 
     // Validation
     bool isValid() const {
@@ -139,13 +195,15 @@ struct GPUData {
     double memoryPercentage;   ///< GPU memory usage percentage
     double frequency;          ///< GPU frequency in MHz
     MetricStatus status;       ///< Current status
-    QDateTime timestamp;       ///< Data collection time
+    qint64 timestampNs;        ///< Sample time (SampleClock, monotonic)
 
     // Constructor
     GPUData() : usage(0.0), temperature(0.0), memoryUsed(0), memoryTotal(0),
-        memoryPercentage(0.0), frequency(0.0), status(MetricStatus::Unknown) {
-        timestamp = QDateTime::currentDateTime();
-    }
+        memoryPercentage(0.0), frequency(0.0), status(MetricStatus::Unknown),
+        timestampNs(0) {}
+
+    // Wall-clock sample time for display
+    QDateTime timestamp() const { return SampleClock::toDateTime(timestampNs); }
 
     // Validation
     bool isValid() const {
@@ -165,16 +223,33 @@ struct NetworkInterfaceData {
     QString ipAddress;          ///< IP address
     qint64 bytesReceived;      ///< Total bytes received
     qint64 bytesSent;          ///< Total bytes sent
+    qint64 packetsReceived;    ///< Total packets received
+    qint64 packetsSent;        ///< Total packets sent
+    qint64 receiveErrors;      ///< Total receive errors
+    qint64 sendErrors;         ///< Total transmit errors
+    qint64 receiveDrops;       ///< Total packets dropped on receive
+    qint64 sendDrops;          ///< Total packets dropped on transmit
     double downloadSpeed;      ///< Current download speed (bytes/sec)
     double uploadSpeed;        ///< Current upload speed (bytes/sec)
-    bool isActive;             ///< Interface is active
-    QDateTime timestamp;       ///< Data collection time
+    double packetReceiveRate;  ///< Packets received per second
+    double packetSendRate;     ///< Packets sent per second
+    double receiveErrorRate;   ///< Receive errors per second
+    double sendErrorRate;      ///< Transmit errors per second
+    double receiveDropRate;    ///< Receive drops per second
+    double sendDropRate;       ///< Transmit drops per second
+    bool isActive;             ///< Traffic seen in the last interval
+    qint64 timestampNs;        ///< Sample time (SampleClock, monotonic)
 
     // Constructor
     NetworkInterfaceData() : bytesReceived(0), bytesSent(0),
-        downloadSpeed(0.0), uploadSpeed(0.0), isActive(false) {
-        timestamp = QDateTime::currentDateTime();
-    }
+        packetsReceived(0), packetsSent(0), receiveErrors(0), sendErrors(0),
+        receiveDrops(0), sendDrops(0), downloadSpeed(0.0), uploadSpeed(0.0),
+        packetReceiveRate(0.0), packetSendRate(0.0), receiveErrorRate(0.0),
+        sendErrorRate(0.0), receiveDropRate(0.0), sendDropRate(0.0),
+        isActive(false), timestampNs(0) {}
+
+    // Wall-clock sample time for display
+    QDateTime timestamp() const { return SampleClock::toDateTime(timestampNs); }
 
     // Validation
     bool isValid() const {
@@ -188,16 +263,20 @@ struct NetworkInterfaceData {
 struct NetworkData {
     QVector<NetworkInterfaceData> interfaces;   ///< All network interfaces
     QString activeInterface;                    ///< Primary active interface
-    double totalDownloadSpeed;                  ///< Total download speed
-    double totalUploadSpeed;                    ///< Total upload speed
+    double totalDownloadSpeed;                  ///< Total download speed (loopback excluded)
+    double totalUploadSpeed;                    ///< Total upload speed (loopback excluded)
+    double totalErrorRate;                      ///< Receive + transmit errors per second
+    double totalDropRate;                       ///< Receive + transmit drops per second
     MetricStatus status;                        ///< Current status
-    QDateTime timestamp;                        ///< Data collection time
+    qint64 timestampNs;                         ///< Sample time (SampleClock, monotonic)
 
     // Constructor
     NetworkData() : totalDownloadSpeed(0.0), totalUploadSpeed(0.0),
-        status(MetricStatus::Unknown) {
-        timestamp = QDateTime::currentDateTime();
-    }
+        totalErrorRate(0.0), totalDropRate(0.0),
+        status(MetricStatus::Unknown), timestampNs(0) {}
+
+    // Wall-clock sample time for display
+    QDateTime timestamp() const { return SampleClock::toDateTime(timestampNs); }
 
     // Validation
     bool isValid() const {
@@ -215,20 +294,22 @@ struct NetworkData {
 struct StorageDeviceData {
     QString path;               ///< Mount path (/, /home, etc.)
     QString filesystem;         ///< Filesystem type (ext4, vfat, etc.)
+    QString device;             ///< Backing block device (mmcblk0p2), empty if none
     qint64 totalSpace;         ///< Total space in bytes
     qint64 usedSpace;          ///< Used space in bytes
     qint64 availableSpace;     ///< Available space in bytes
     double usagePercentage;    ///< Usage percentage
     double temperature;        ///< Storage temperature (if available)
     MetricStatus status;       ///< Current status
-    QDateTime timestamp;       ///< Data collection time
+    qint64 timestampNs;        ///< Sample time (SampleClock, monotonic)
 
     // Constructor
     StorageDeviceData() : totalSpace(0), usedSpace(0), availableSpace(0),
         usagePercentage(0.0), temperature(0.0),
-        status(MetricStatus::Unknown) {
-        timestamp = QDateTime::currentDateTime();
-    }
+        status(MetricStatus::Unknown), timestampNs(0) {}
+
+    // Wall-clock sample time for display
+    QDateTime timestamp() const { return SampleClock::toDateTime(timestampNs); }
 
     // Validation
     bool isValid() const {
@@ -237,19 +318,59 @@ struct StorageDeviceData {
     }
 };
 
+/**
+ * @brief I/O activity of one block device from /proc/diskstats
+ * Rates cover the last sampling interval.
+ */
+struct BlockDeviceData {
+    QString name;               ///< Kernel name (sda, mmcblk0p2, nvme0n1)
+    bool isPartition;           ///< Partition of another listed device
+    double readSpeed;           ///< Bytes read per second
+    double writeSpeed;          ///< Bytes written per second
+    double readIops;            ///< Read requests completed per second
+    double writeIops;           ///< Write requests completed per second
+    double serviceTime;         ///< Average busy time per request (ms)
+    double queueDepth;          ///< Average requests queued or in service
+    double utilization;         ///< Share of the interval the device was busy (%)
+    int inFlight;               ///< Requests in progress at the sample
+    qint64 timestampNs;         ///< Sample time (SampleClock, monotonic)
+
+    // Constructor
+    BlockDeviceData() : isPartition(false), readSpeed(0.0), writeSpeed(0.0),
+        readIops(0.0), writeIops(0.0), serviceTime(0.0), queueDepth(0.0),
+        utilization(0.0), inFlight(0), timestampNs(0) {}
+
+    // Wall-clock sample time for display
+    QDateTime timestamp() const { return SampleClock::toDateTime(timestampNs); }
+
+    // Validation
+    bool isValid() const {
+        return !name.isEmpty() && utilization >= 0.0 && utilization <= 100.0;
+    }
+};
+
 /**
  * @brief Complete storage monitoring data
  */
 struct StorageData {
     QVector<StorageDeviceData> devices;         ///< All storage devices
+    QVector<BlockDeviceData> blockDevices;     ///< Block devices that have done I/O
     double totalUsagePercentage;               ///< Overall usage percentage
+    double totalReadSpeed;                     ///< Bytes read per second, whole disks
+    double totalWriteSpeed;                    ///< Bytes written per second, whole disks
+    double totalIops;                          ///< Requests per second, whole disks
+    double peakUtilization;                    ///< Busiest device's utilization (%)
+    QString busiestDevice;                     ///< Device with peakUtilization
     MetricStatus status;                       ///< Current status
-    QDateTime timestamp;                       ///< Data collection time
+    qint64 timestampNs;                        ///< Sample time (SampleClock, monotonic)
 
     // Constructor
-    StorageData() : totalUsagePercentage(0.0), status(MetricStatus::Unknown) {
-        timestamp = QDateTime::currentDateTime();
-    }
+    StorageData() : totalUsagePercentage(0.0), totalReadSpeed(0.0),
+        totalWriteSpeed(0.0), totalIops(0.0), peakUtilization(0.0),
+        status(MetricStatus::Unknown), timestampNs(0) {}
+
+    // Wall-clock sample time for display
+    QDateTime timestamp() const { return SampleClock::toDateTime(timestampNs); }
 
     // Validation
     bool isValid() const {
@@ -272,15 +393,17 @@ struct SystemData {
     double loadAverage1min;    ///< 1-minute load average
     double loadAverage5min;    ///< 5-minute load average
     double loadAverage15min;   ///< 15-minute load average
-    int processCount;          ///< Total number of processes
+    int runningProcesses;      ///< Runnable tasks (threads included, /proc/loadavg)
+    int processCount;          ///< Total tasks (threads included, /proc/loadavg)
     QDateTime bootTime;        ///< System boot time
-    QDateTime timestamp;       ///< Data collection time
+    qint64 timestampNs;        ///< Sample time (SampleClock, monotonic)
 
     // Constructor
     SystemData() : uptime(0), loadAverage1min(0.0), loadAverage5min(0.0),
-        loadAverage15min(0.0), processCount(0) {
-        timestamp = QDateTime::currentDateTime();
-    }
+        loadAverage15min(0.0), runningProcesses(0), processCount(0), timestampNs(0) {}
+
+    // Wall-clock sample time for display
+    QDateTime timestamp() const { return SampleClock::toDateTime(timestampNs); }
 
     // Validation
     bool isValid() const {
@@ -288,6 +411,61 @@ struct SystemData {
     }
 };
 
+// ===================================================================
+// PROCESS DATA STRUCTURES
+// ===================================================================
+
+/**
+ * @brief One process of a top list
+ */
+struct ProcessData {
+    qint32 pid;                 ///< Process ID
+    qint32 parentPid;           ///< Parent process ID
+    QString name;               ///< Command name (comm, 15 characters max)
+    char state;                 ///< R, S, D, Z, T, I...
+    double cpuUsage;            ///< CPU usage in percent of one core (top-style)
+    qint64 memoryRss;           ///< Resident set size in bytes
+    qint64 memoryShared;        ///< Resident shared (file-backed) bytes
+    qint64 memoryVirtual;       ///< Virtual size in bytes
+    int threadCount;            ///< Threads in the process
+    QDateTime startTime;        ///< Process start time
+
+    // Constructor
+    ProcessData() : pid(0), parentPid(0), state('?'), cpuUsage(0.0),
+        memoryRss(0), memoryShared(0), memoryVirtual(0), threadCount(0) {}
+
+    // Validation
+    bool isValid() const {
+        return pid > 0 && cpuUsage >= 0.0 && memoryRss >= 0;
+    }
+};
+
+/**
+ * @brief Process table summary with the heaviest processes
+ */
+struct ProcessListData {
+    QVector<ProcessData> topByCpu;      ///< Highest CPU usage first
+    QVector<ProcessData> topByMemory;   ///< Largest resident set first
+    int processCount;                   ///< Processes in /proc
+    int threadCount;                    ///< Threads over all processes
+    int runningCount;                   ///< Processes in state R
+    double totalCpuUsage;               ///< Sum of all processes (percent of one core)
+    MetricStatus status;                ///< Current status
+    qint64 timestampNs;                 ///< Sample time (SampleClock, monotonic)
+
+    // Constructor
+    ProcessListData() : processCount(0), threadCount(0), runningCount(0),
+        totalCpuUsage(0.0), status(MetricStatus::Unknown), timestampNs(0) {}
+
+    // Wall-clock sample time for display
+    QDateTime timestamp() const { return SampleClock::toDateTime(timestampNs); }
+
+    // Validation
+    bool isValid() const {
+        return processCount > 0;
+    }
+};
+
 // ===================================================================
 // ALERT DATA STRUCTURES
 // ===================================================================
@@ -303,10 +481,8 @@ struct AlertData {
     QDateTime timestamp;        ///< When alert was created
     bool acknowledged;          ///< Whether alert was acknowledged
 
-    // Constructor
-    AlertData() : severity(AlertSeverity::Info), acknowledged(false) {
-        timestamp = QDateTime::currentDateTime();
-    }
+    // Constructor (timestamp is set by AlertManager::addAlert())
+    AlertData() : severity(AlertSeverity::Info), acknowledged(false) {}
 
     // Validation
     bool isValid() const {
@@ -314,6 +490,35 @@ struct AlertData {
     }
 };
 
+// ===================================================================
+// MONITOR OVERHEAD (the monitor's own cost)
+// ===================================================================
+
+/**
+ * @brief CPU and memory spent by a monitor itself
+ */
+struct MonitorOverhead {
+    qint64 cpuTimeNs;           ///< Thread CPU time spent sampling (cumulative)
+    double cpuPercent;          ///< Recent cost in % of one core (tick cost / interval)
+    qint64 memoryBytes;         ///< Retained memory estimate (history, buffers)
+    quint64 ticks;              ///< Samples taken
+    double cpuBudgetPercent;    ///< Budget in % of one core, 0 = none
+    int budgetIntervalMs;       ///< Interval floor imposed by the budget, 0 = none
+
+    // Constructor
+    MonitorOverhead() : cpuTimeNs(0), cpuPercent(0.0), memoryBytes(0), ticks(0),
+        cpuBudgetPercent(0.0), budgetIntervalMs(0) {}
+
+    // Sum of several monitors (budget fields stay per monitor)
+    MonitorOverhead& operator+=(const MonitorOverhead& other) {
+        cpuTimeNs += other.cpuTimeNs;
+        cpuPercent += other.cpuPercent;
+        memoryBytes += other.memoryBytes;
+        ticks += other.ticks;
+        return *this;
+    }
+};
+
 // ===================================================================
 // REGISTER METATYPES (for Qt signals/slots)
 // ===================================================================
@@ -328,6 +533,7 @@ Q_DECLARE_METATYPE(GPUData)
 Q_DECLARE_METATYPE(NetworkData)
 Q_DECLARE_METATYPE(StorageData)
 Q_DECLARE_METATYPE(SystemData)
+Q_DECLARE_METATYPE(ProcessListData)
 Q_DECLARE_METATYPE(AlertData)
 
 #endif // TYPES_H
@@ -7,6 +7,9 @@
 
 #include "basemonitor.h"
 #include <QDebug>
+#include <QMetaMethod>
+#include <QThread>
+#include <cmath>
 
 BaseMonitor::BaseMonitor(QObject *parent)
     : QObject (parent)
@@ -14,24 +17,53 @@ BaseMonitor::BaseMonitor(QObject *parent)
     , m_isMonitoring(false)
     , m_isPaused(false)
     , m_updateInterval(UPDATE_INTERVAL)
+    , m_configuredInterval(UPDATE_INTERVAL)
+    , m_externallyScheduled(false)
+    , m_lastUpdateNs(0)
+    , m_lastAdaptiveValue(0.0)
+    , m_hasAdaptiveValue(false)
+    , m_calmSamples(0)
+    , m_missedDeadlines(0)
+    , m_overruns(0)
+    , m_lastTickStartNs(0)
+    , m_latencyDumpIntervalMs(LATENCY_DUMP_INTERVAL)
+    , m_lastDumpNs(0)
+    , m_cpuTimeNs(0)
+    , m_tickCpuNs(0.0)
+    , m_memoryBytes(0)
+    , m_overheadTicks(0)
+    , m_cpuBudgetPercent(0.0)
+    , m_budgetIntervalMs(0)
+    , m_subscriptions(0)
+    , m_ownerConnections(0)
+    , m_demandDriven(false)
+    , m_isParked(false)
 {
     connect(m_updateTimer, &QTimer::timeout, this, &BaseMonitor::onTimerTick);
     m_updateTimer->setSingleShot(false);
+    // Precise timers advance from the previous deadline instead of the
+    // actual wakeup, so the standalone timer does not drift either
+    m_updateTimer->setTimerType(Qt::PreciseTimer);
 }
 
 void BaseMonitor::startMonitoring()
 {
+    if (invokeInOwnerThread([this] { startMonitoring(); })) return;
     if (m_isMonitoring) return;
 
     m_isMonitoring = true;
     m_isPaused = false;
-    m_updateTimer->start(m_updateInterval);
+    m_lastTickStartNs = 0;
+    if (!m_externallyScheduled && !m_isParked) {
+        m_updateTimer->start(m_updateInterval);
+    }
 
     emit monitoringStarted();
 }
 
 void BaseMonitor::stopMonitoring()
 {
+    if (invokeInOwnerThread([this] { stopMonitoring(); })) return;
     if (!m_isMonitoring) return;
 
     m_updateTimer->stop();
@@ -48,44 +80,538 @@ void BaseMonitor::pauseMonitoring()
 
 void BaseMonitor::resumeMonitoring()
 {
+    // The pause is not a missed deadline
+    m_lastTickStartNs = 0;
     m_isPaused= false;
 }
 
 void BaseMonitor::setUpdateInterval(int intervalMs)
 {
-    m_updateInterval = qMax(100, intervalMs);
-    if (m_isMonitoring) {
-        m_updateTimer->setInterval(m_updateInterval);
+    if (invokeInOwnerThread([this, intervalMs] { setUpdateInterval(intervalMs); })) return;
+
+    m_configuredInterval = qMax(MIN_UPDATE_INTERVAL, intervalMs);
+
+    int interval = m_configuredInterval;
+    {
+        QMutexLocker locker(&m_dataMutex);
+        if (m_adaptivePolicy.enabled) {
+            interval = qBound(m_adaptivePolicy.minIntervalMs, interval, m_adaptivePolicy.maxIntervalMs);
+        }
+    }
+
+    applyInterval(interval);
+}
+
+void BaseMonitor::setAdaptivePolicy(const AdaptiveSamplingPolicy &policy)
+{
+    if (invokeInOwnerThread([this, policy] { setAdaptivePolicy(policy); })) return;
+
+    AdaptiveSamplingPolicy sanitized = policy;
+    sanitized.minIntervalMs = qMax(MIN_UPDATE_INTERVAL, policy.minIntervalMs);
+    sanitized.maxIntervalMs = qMax(sanitized.minIntervalMs, policy.maxIntervalMs);
+    sanitized.calmDelta = qMin(policy.calmDelta, policy.volatileDelta);
+    sanitized.calmSamplesToSlowDown = qMax(1, policy.calmSamplesToSlowDown);
+
+    {
+        QMutexLocker locker(&m_dataMutex);
+        m_adaptivePolicy = sanitized;
+        m_hasAdaptiveValue = false;
+        m_calmSamples = 0;
+    }
+
+    int interval = m_configuredInterval;
+    if (sanitized.enabled) {
+        interval = qBound(sanitized.minIntervalMs, interval, sanitized.maxIntervalMs);
+    }
+    if (interval != m_updateInterval) {
+        applyInterval(interval);
+    }
+}
+
+AdaptiveSamplingPolicy BaseMonitor::getAdaptivePolicy() const
+{
+    QMutexLocker locker(&m_dataMutex);
+    return m_adaptivePolicy;
+}
+
+void BaseMonitor::setExternallyScheduled(bool external)
+{
+    if (invokeInOwnerThread([this, external] { setExternallyScheduled(external); })) return;
+    if (m_externallyScheduled == external) return;
+
+    m_externallyScheduled = external;
+    if (!m_isMonitoring) return;
+
+    if (external) {
+        m_updateTimer->stop();
+    } else if (!m_isParked) {
+        m_updateTimer->start(m_updateInterval);
+    }
+}
+
+// ===================================================================
+// DEMAND TRACKING
+// ===================================================================
+
+MonitorSubscription::MonitorSubscription(BaseMonitor *monitor)
+    : m_monitor(monitor)
+{
+    if (monitor) {
+        monitor->addSubscribers(1);
+    }
+}
+
+MonitorSubscription::MonitorSubscription(MonitorSubscription &&other) noexcept
+    : m_monitor(other.m_monitor)
+{
+    other.m_monitor = nullptr;
+}
+
+MonitorSubscription &MonitorSubscription::operator=(MonitorSubscription &&other) noexcept
+{
+    if (this != &other) {
+        release();
+        m_monitor = other.m_monitor;
+        other.m_monitor = nullptr;
+    }
+    return *this;
+}
+
+void MonitorSubscription::release()
+{
+    if (m_monitor) {
+        m_monitor->addSubscribers(-1);
+        m_monitor = nullptr;
+    }
+}
+
+MonitorSubscription BaseMonitor::subscribe()
+{
+    return MonitorSubscription(this);
+}
+
+int BaseMonitor::subscriberCount() const
+{
+    return m_subscriptions + qMax(0, dataConnectionCount() - m_ownerConnections);
+}
+
+int BaseMonitor::dataConnectionCount() const
+{
+    int connections = 0;
+    const QMetaObject* meta = metaObject();
+    for (int i = QObject::staticMetaObject.methodCount(); i < meta->methodCount(); ++i) {
+        const QMetaMethod method = meta->method(i);
+        if (method.methodType() != QMetaMethod::Signal || !isDemandSignal(method)) continue;
+
+        const QByteArray signature = QByteArray::number(QSIGNAL_CODE) + method.methodSignature();
+        connections += receivers(signature.constData());
+    }
+    return connections;
+}
+
+void BaseMonitor::setDemandDriven(bool enabled)
+{
+    m_demandDriven = enabled;
+    requestDemandUpdate();
+}
+
+void BaseMonitor::markOwnerConnections()
+{
+    m_ownerConnections = dataConnectionCount();
+    requestDemandUpdate();
+}
+
+void BaseMonitor::connectNotify(const QMetaMethod &signal)
+{
+    if (isDemandSignal(signal)) requestDemandUpdate();
+}
+
+void BaseMonitor::disconnectNotify(const QMetaMethod &signal)
+{
+    // An invalid method is a wildcard disconnect, recount as well
+    if (!signal.isValid() || isDemandSignal(signal)) requestDemandUpdate();
+}
+
+bool BaseMonitor::isDemandSignal(const QMetaMethod &signal) const
+{
+    // QObject's own signals and the lifecycle signals are infrastructure
+    // (SamplingScheduler, DataManager), everything else carries data
+    static const QMetaMethod lifecycle[] = {
+        QMetaMethod::fromSignal(&BaseMonitor::monitoringStarted),
+        QMetaMethod::fromSignal(&BaseMonitor::monitoringStopped),
+        QMetaMethod::fromSignal(&BaseMonitor::updateIntervalChanged),
+        QMetaMethod::fromSignal(&BaseMonitor::parkedChanged),
+        QMetaMethod::fromSignal(&BaseMonitor::errorOccurred)
+    };
+
+    if (signal.methodIndex() < QObject::staticMetaObject.methodCount()) return false;
+    for (const QMetaMethod& method : lifecycle) {
+        if (signal == method) return false;
+    }
+    return true;
+}
+
+void BaseMonitor::addSubscribers(int delta)
+{
+    m_subscriptions += delta;
+    requestDemandUpdate();
+}
+
+void BaseMonitor::requestDemandUpdate()
+{
+    // Always queued: the notify hooks may run in another thread or with
+    // the connection lock held, where emitting or connecting deadlocks
+    QMetaObject::invokeMethod(this, [this] { updateDemand(); }, Qt::QueuedConnection);
+}
+
+void BaseMonitor::updateDemand()
+{
+    const bool parked = m_demandDriven && subscriberCount() == 0;
+    if (parked == m_isParked) return;
+
+    m_isParked = parked;
+    m_lastTickStartNs = 0;
+
+    if (m_isMonitoring && !m_externallyScheduled) {
+        if (parked) {
+            m_updateTimer->stop();
+        } else {
+            m_updateTimer->start(m_updateInterval);
+        }
+    }
+
+    if (!parked && m_isMonitoring) {
+        // Warm-up collect: prime the raw counters so the first delta
+        // covers one interval, not the whole parked period
+        try {
+            QMutexLocker locker(&m_dataMutex);
+            collectData();
+            m_hasAdaptiveValue = false;
+            m_calmSamples = 0;
+        } catch (const std::exception& e) {
+            emit errorOccurred(QString::fromStdString(e.what()));
+        }
+    }
+
+    emit parkedChanged(parked);
+}
+
+QDateTime BaseMonitor::getLastUpdateTime() const
+{
+    QMutexLocker locker(&m_dataMutex);
+    return SampleClock::toDateTime(m_lastUpdateNs);
+}
+
+TickLatencyStats BaseMonitor::getLatencyStats() const
+{
+    QMutexLocker locker(&m_statsMutex);
+
+    TickLatencyStats stats;
+    for (int phase = 0; phase < TickLatencyStats::PhaseCount; ++phase) {
+        const LatencyHistogram& histogram = m_phaseLatency[phase];
+        stats.phases[phase].count = histogram.count();
+        stats.phases[phase].p50Ns = histogram.percentile(50.0);
+        stats.phases[phase].p99Ns = histogram.percentile(99.0);
+        stats.phases[phase].maxNs = histogram.max();
+    }
+    stats.missedDeadlines = m_missedDeadlines;
+    stats.overruns = m_overruns;
+    return stats;
+}
+
+void BaseMonitor::resetLatencyStats()
+{
+    QMutexLocker locker(&m_statsMutex);
+    for (LatencyHistogram& histogram : m_phaseLatency) {
+        histogram.reset();
+    }
+    m_missedDeadlines = 0;
+    m_overruns = 0;
+}
+
+const char* TickLatencyStats::phaseName(int phase)
+{
+    switch (phase) {
+    case Collect: return "collect";
+    case Process: return "process";
+    case Validate: return "validate";
+    case Emit: return "emit";
+    case Total: return "total";
+    default: return "unknown";
     }
 }
 
+void BaseMonitor::shutdown(QThread *targetThread)
+{
+    if (invokeInOwnerThread([this, targetThread] { shutdown(targetThread); })) return;
+
+    stopMonitoring();
+    if (targetThread && targetThread != thread()) {
+        moveToThread(targetThread);
+    }
+}
+
+bool BaseMonitor::invokeInOwnerThread(const std::function<void()> &call)
+{
+    QThread* owner = thread();
+    if (owner == QThread::currentThread()) {
+        return false;
+    }
+
+    if (!owner->isRunning()) {
+        // Nobody would ever run the call, blocking would deadlock
+        qWarning() << "BaseMonitor: owner thread not running, call dropped";
+        return true;
+    }
+
+    QMetaObject::invokeMethod(this, call, Qt::BlockingQueuedConnection);
+    return true;
+}
+
 void BaseMonitor::updateTimestamp()
 {
-    m_lastUpdateTime = QDateTime::currentDateTime();
+    m_lastUpdateNs = SampleClock::nowNs();
 }
 
 bool BaseMonitor::isDataState(int maxAgeMs) const
 {
-    return m_lastUpdateTime.msecsTo(QDateTime::currentDateTime()) > maxAgeMs;
+    return (SampleClock::nowNs() - m_lastUpdateNs) / 1000000 > maxAgeMs;
+}
+
+bool BaseMonitor::adaptiveMetric(double *value, double *threshold) const
+{
+    Q_UNUSED(value);
+    Q_UNUSED(threshold);
+    return false;
+}
+
+// ===================================================================
+// ADAPTIVE SAMPLING
+// ===================================================================
+
+int BaseMonitor::adaptInterval()
+{
+    // Called with m_dataMutex held, returns the interval for the next sample
+    const int current = m_updateInterval;
+    const AdaptiveSamplingPolicy& policy = m_adaptivePolicy;
+    if (!policy.enabled) return m_configuredInterval;
+
+    double value = 0.0;
+    double threshold = 0.0;
+    if (!adaptiveMetric(&value, &threshold)) return current;
+
+    const double delta = m_hasAdaptiveValue ? qAbs(value - m_lastAdaptiveValue) : 0.0;
+    m_lastAdaptiveValue = value;
+    m_hasAdaptiveValue = true;
+
+    // Spike or close to the alert level: fastest rate right away
+    if (delta >= policy.volatileDelta || value >= threshold - policy.thresholdMargin) {
+        m_calmSamples = 0;
+        return policy.minIntervalMs;
+    }
+
+    // Hysteresis band: neither hot nor flat, keep the rate
+    if (delta > policy.calmDelta) {
+        m_calmSamples = 0;
+        return current;
+    }
+
+    if (++m_calmSamples < policy.calmSamplesToSlowDown) {
+        return current;
+    }
+
+    m_calmSamples = 0;
+    return qMin(policy.maxIntervalMs, current * 2);
+}
+
+// ===================================================================
+// SELF OVERHEAD
+// ===================================================================
+
+qint64 BaseMonitor::memoryFootprint() const
+{
+    return 0;
+}
+
+MonitorOverhead BaseMonitor::getOverhead() const
+{
+    QMutexLocker locker(&m_statsMutex);
+
+    MonitorOverhead overhead;
+    overhead.cpuTimeNs = m_cpuTimeNs;
+    overhead.cpuPercent = m_tickCpuNs / (static_cast<double>(m_updateInterval) * 1e6) * 100.0;
+    overhead.memoryBytes = m_memoryBytes;
+    overhead.ticks = m_overheadTicks;
+    overhead.cpuBudgetPercent = m_cpuBudgetPercent;
+    overhead.budgetIntervalMs = m_budgetIntervalMs;
+    return overhead;
+}
+
+void BaseMonitor::setCpuBudget(double percentOfCore)
+{
+    QMutexLocker locker(&m_statsMutex);
+    m_cpuBudgetPercent = qMax(0.0, percentOfCore);
+    if (m_cpuBudgetPercent <= 0.0) {
+        // Takes effect on the next tick
+        m_budgetIntervalMs = 0;
+    }
+}
+
+int BaseMonitor::recordOverhead(qint64 cpuNs, qint64 memoryBytes)
+{
+    QMutexLocker locker(&m_statsMutex);
+
+    m_cpuTimeNs += cpuNs;
+    m_memoryBytes = memoryBytes;
+    // Smoothed so one slow tick (page fault, cold cache) does not
+    // throttle the monitor on its own
+    m_tickCpuNs = (m_overheadTicks == 0) ? cpuNs : 0.8 * m_tickCpuNs + 0.2 * cpuNs;
+    ++m_overheadTicks;
+
+    if (m_cpuBudgetPercent <= 0.0) {
+        m_budgetIntervalMs = 0;
+        return 0;
+    }
+
+    // Shortest interval at which the tick cost fits the budget, rounded
+    // up to whole scheduler ticks so rounding cannot undercut it
+    const double floorMs = m_tickCpuNs / (m_cpuBudgetPercent / 100.0) / 1e6;
+    const int baseTicks = static_cast<int>(std::ceil(floorMs / SCHEDULER_BASE_TICK));
+    m_budgetIntervalMs = qMin(MAX_UPDATE_INTERVAL, baseTicks * SCHEDULER_BASE_TICK);
+    return m_budgetIntervalMs;
+}
+
+void BaseMonitor::applyInterval(int intervalMs)
+{
+    m_updateInterval = intervalMs;
+    if (m_isMonitoring && !m_externallyScheduled) {
+        m_updateTimer->setInterval(intervalMs);
+    }
+
+    // A SamplingScheduler re-phases the monitor on this signal
+    emit updateIntervalChanged(intervalMs);
+}
+
+// ===================================================================
+// TICK LATENCY
+// ===================================================================
+
+void BaseMonitor::recordLatency(const qint64 (&phaseNs)[TickLatencyStats::PhaseCount], qint64 startNs)
+{
+    // Interval that scheduled this tick (adaptation is applied afterwards)
+    const qint64 intervalNs = static_cast<qint64>(m_updateInterval) * 1000000LL;
+    const qint64 previousStartNs = m_lastTickStartNs.exchange(startNs);
+
+    {
+        QMutexLocker locker(&m_statsMutex);
+        for (int phase = 0; phase < TickLatencyStats::PhaseCount; ++phase) {
+            m_phaseLatency[phase].record(phaseNs[phase]);
+        }
+
+        if (phaseNs[TickLatencyStats::Total] > intervalNs) {
+            ++m_overruns;
+        }
+
+        // A gap of N intervals since the previous tick skipped N - 1 samples
+        if (previousStartNs > 0) {
+            const qint64 periods = (startNs - previousStartNs + intervalNs / 2) / intervalNs;
+            if (periods > 1) {
+                m_missedDeadlines += static_cast<quint64>(periods - 1);
+            }
+        }
+    }
+
+    const int dumpIntervalMs = m_latencyDumpIntervalMs;
+    if (dumpIntervalMs <= 0) return;
+
+    if (m_lastDumpNs == 0) {
+        m_lastDumpNs = startNs;
+    } else if (startNs - m_lastDumpNs >= static_cast<qint64>(dumpIntervalMs) * 1000000LL) {
+        m_lastDumpNs = startNs;
+        dumpLatencyStats();
+    }
+}
+
+void BaseMonitor::dumpLatencyStats()
+{
+    const TickLatencyStats stats = getLatencyStats();
+
+    qDebug().nospace() << metaObject()->className() << " tick latency: "
+                       << stats.phases[TickLatencyStats::Total].count << " ticks, "
+                       << stats.missedDeadlines << " missed deadlines, "
+                       << stats.overruns << " overruns";
+
+    for (int phase = 0; phase < TickLatencyStats::PhaseCount; ++phase) {
+        const TickLatencyStats::PhaseLatency& latency = stats.phases[phase];
+        qDebug().nospace() << "  " << TickLatencyStats::phaseName(phase)
+                           << ": p50 " << latency.p50Ns / 1000.0 << " us"
+                           << ", p99 " << latency.p99Ns / 1000.0 << " us"
+                           << ", max " << latency.maxNs / 1000.0 << " us";
+    }
+
+    const MonitorOverhead overhead = getOverhead();
+    qDebug().nospace() << "  overhead: " << overhead.cpuPercent << "% of a core, "
+                       << overhead.memoryBytes / 1024 << " KiB retained";
 }
 
 void BaseMonitor::onTimerTick()
 {
-    if (m_isPaused) return;
+    sample();
+}
+
+void BaseMonitor::sample()
+{
+    if (!m_isMonitoring || m_isPaused || m_isParked) {
+        m_lastTickStartNs = 0;
+        return;
+    }
+
+    const qint64 cpuStartNs = SampleClock::threadCpuNs();
+    qint64 phaseNs[TickLatencyStats::PhaseCount] = {};
+    qint64 startNs = 0;
+    qint64 footprint = 0;
+    bool completed = false;
+    int nextInterval = m_updateInterval;
 
     try {
         QMutexLocker locker(&m_dataMutex);
 
-        // Templdate Method execution
+        // Templdate Method execution, each phase timed
+        startNs = SampleClock::nowNs();
         collectData();
+        const qint64 collectedNs = SampleClock::nowNs();
         processData();
+        const qint64 processedNs = SampleClock::nowNs();
         validateData();
+        const qint64 validatedNs = SampleClock::nowNs();
         emitSignal();
+        const qint64 emittedNs = SampleClock::nowNs();
+
+        phaseNs[TickLatencyStats::Collect] = collectedNs - startNs;
+        phaseNs[TickLatencyStats::Process] = processedNs - collectedNs;
+        phaseNs[TickLatencyStats::Validate] = validatedNs - processedNs;
+        phaseNs[TickLatencyStats::Emit] = emittedNs - validatedNs;
+        phaseNs[TickLatencyStats::Total] = emittedNs - startNs;
+        completed = true;
 
         updateTimestamp();
+        nextInterval = adaptInterval();
+        footprint = memoryFootprint();
         emit dataUpdated();
     } catch (const std::exception& e) {
         emit errorOccurred(QString::fromStdString(e.what()));
     }
-}
 
+    if (completed) {
+        recordLatency(phaseNs, startNs);
+
+        // Over budget: the interval may not drop below the budget floor
+        const int budgetIntervalMs = recordOverhead(SampleClock::threadCpuNs() - cpuStartNs, footprint);
+        nextInterval = qMax(nextInterval, budgetIntervalMs);
+    }
+
+    // Outside the lock, interval listeners may query the monitor
+    if (nextInterval != m_updateInterval) {
+        applyInterval(nextInterval);
+    }
+}
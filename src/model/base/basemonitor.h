@@ -12,12 +12,113 @@
 #include <QTimer>
 #include <QMutex>
 #include <QDateTime>
+#include <QPointer>
+#include <atomic>
+#include <functional>
 #include "core/constants.h"
 #include "core/types.h"
+#include "core/latencyhistogram.h"
+
+/**
+ * @brief Volatility-driven sampling interval policy
+ *
+ * After each sample the monitor compares its primary metric with the
+ * previous one. A jump of at least volatileDelta, or a value within
+ * thresholdMargin of the alert threshold, drops the interval straight
+ * to minIntervalMs so short spikes are caught. Only after
+ * calmSamplesToSlowDown consecutive changes below calmDelta does the
+ * interval double, up to maxIntervalMs. Changes between the two deltas
+ * keep the current interval (hysteresis band).
+ */
+struct AdaptiveSamplingPolicy {
+    bool enabled;
+    int minIntervalMs;              // Fastest sampling (spikes, near threshold)
+    int maxIntervalMs;              // Slowest sampling (flat signal)
+    double volatileDelta;           // Change per sample that counts as a spike
+    double calmDelta;               // Change per sample that counts as flat
+    double thresholdMargin;         // Distance to the threshold that counts as hot
+    int calmSamplesToSlowDown;      // Flat samples in a row before backing off
+
+    AdaptiveSamplingPolicy()
+        : enabled(false)
+        , minIntervalMs(MIN_UPDATE_INTERVAL)
+        , maxIntervalMs(MAX_UPDATE_INTERVAL)
+        , volatileDelta(10.0)
+        , calmDelta(2.0)
+        , thresholdMargin(10.0)
+        , calmSamplesToSlowDown(5) {}
+};
+
+/**
+ * @brief Tick latency summary of one monitor
+ * Percentiles come from LatencyHistogram (within 6.25%), max is exact.
+ */
+struct TickLatencyStats {
+    enum Phase { Collect = 0, Process, Validate, Emit, Total, PhaseCount };
+
+    struct PhaseLatency {
+        quint64 count;
+        qint64 p50Ns;
+        qint64 p99Ns;
+        qint64 maxNs;
+
+        PhaseLatency() : count(0), p50Ns(0), p99Ns(0), maxNs(0) {}
+    };
+
+    PhaseLatency phases[PhaseCount];
+    quint64 missedDeadlines;    // Sampling periods skipped by late ticks
+    quint64 overruns;           // Ticks that took longer than the interval
+
+    TickLatencyStats() : missedDeadlines(0), overruns(0) {}
+
+    static const char* phaseName(int phase);
+};
+
+class BaseMonitor;
+
+/**
+ * @brief RAII demand handle on a monitor (see BaseMonitor::subscribe())
+ * Movable, not copyable. Releasing the last handle lets a demand-driven
+ * monitor park. Safe to create and release from any thread.
+ */
+class MonitorSubscription
+{
+public:
+    MonitorSubscription() = default;
+    explicit MonitorSubscription(BaseMonitor* monitor);
+    ~MonitorSubscription() { release(); }
+
+    MonitorSubscription(MonitorSubscription&& other) noexcept;
+    MonitorSubscription& operator=(MonitorSubscription&& other) noexcept;
+
+    void release();
+    bool isActive() const { return !m_monitor.isNull(); }
+
+private:
+    MonitorSubscription(const MonitorSubscription&) = delete;
+    MonitorSubscription& operator=(const MonitorSubscription&) = delete;
+
+    QPointer<BaseMonitor> m_monitor;
+};
 
 /**
  * @brief Abstract base monitor using Template method pattern
  * Thread-safe monitoring lifecylce management
+ *
+ * Threading: a monitor samples in the thread it lives in. DataManager
+ * creates monitors without a parent, owns them and moves them to its
+ * collector thread. Control calls made from another thread (start,
+ * stop, interval changes) are forwarded to the monitor's thread and
+ * block until applied; results reach other threads through queued
+ * signals or the mutex-guarded getters. shutdown() must run before the
+ * collector thread quits so the monitor can be destroyed by its owner.
+ *
+ * Demand: subscribers are subscribe() handles plus connections to any
+ * data signal (everything except the lifecycle signals). A
+ * demand-driven monitor without subscribers parks: its timer stops, a
+ * SamplingScheduler skips it, sample() is a no-op. The first subscriber
+ * unparks it with a warm-up collect, so the first delta after a long
+ * park covers one interval instead of the whole parked period.
  */
 
 class BaseMonitor : public QObject
@@ -36,11 +137,86 @@ public:
     // Configuration
     void setUpdateInterval(int intervalMs);
     int getUpdateInterval() const { return m_updateInterval; }
+    int getConfiguredInterval() const { return m_configuredInterval; }
+
+    /**
+     * @brief Let the sampling interval follow the metric's volatility
+     * While enabled, getUpdateInterval() is the current adaptive
+     * interval and setUpdateInterval() only sets the starting point.
+     * Disabling restores the configured interval.
+     */
+    void setAdaptivePolicy(const AdaptiveSamplingPolicy& policy);
+    AdaptiveSamplingPolicy getAdaptivePolicy() const;
+
+    /**
+     * @brief Let a SamplingScheduler drive sample() instead of the own timer
+     * @param external true to leave the internal QTimer idle
+     */
+    void setExternallyScheduled(bool external);
+    bool isExternallyScheduled() const { return m_externallyScheduled; }
+
+    /**
+     * @brief Run one collect/process/validate/emit cycle now
+     * No-op when stopped or paused. Must run in the monitor's thread.
+     */
+    void sample();
+
+    // Demand tracking
+    MonitorSubscription subscribe();
+    int subscriberCount() const;
+
+    /**
+     * @brief Park the monitor while nobody is subscribed
+     * Off by default: the monitor samples whenever it is started.
+     */
+    void setDemandDriven(bool enabled);
+    bool isDemandDriven() const { return m_demandDriven; }
+    bool isParked() const { return m_isParked; }
+
+    /**
+     * @brief Treat the current connections as owner plumbing, not demand
+     * DataManager calls this after wiring aggregation and alerts, so only
+     * consumers connecting later keep the monitor awake.
+     */
+    void markOwnerConnections();
 
     // Staus queries
     bool isMonitoring() const { return m_isMonitoring; }
     bool isPaused() const { return m_isPaused; }
-    QDateTime getLastUpdateTime() const { return m_lastUpdateTime; }
+    QDateTime getLastUpdateTime() const;
+
+    /**
+     * @brief Per-phase tick latencies (collect, process, validate, emit)
+     * Any thread; the collector holds the stats lock only to record.
+     */
+    TickLatencyStats getLatencyStats() const;
+    void resetLatencyStats();
+
+    /**
+     * @brief The monitor's own CPU time and memory (any thread)
+     */
+    MonitorOverhead getOverhead() const;
+
+    /**
+     * @brief Cap the monitor's CPU cost, in percent of one core
+     * When the measured cost per tick exceeds the budget at the current
+     * interval, the interval is lengthened until it fits (up to
+     * MAX_UPDATE_INTERVAL). 0 removes the budget.
+     */
+    void setCpuBudget(double percentOfCore);
+
+    /**
+     * @brief Period of the qDebug() latency dump, 0 disables it
+     * Off by default; e.g. 60000 dumps the tick latencies once a minute.
+     */
+    void setLatencyDumpInterval(int intervalMs) { m_latencyDumpIntervalMs = intervalMs; }
+
+    /**
+     * @brief Stop sampling and move the monitor to another thread
+     * Called by the owner before the monitor's thread quits.
+     * @param targetThread Thread the monitor will be destroyed in
+     */
+    void shutdown(QThread* targetThread);
 
 protected:
     // Template Method - implement in concrete classes
@@ -49,10 +225,30 @@ protected:
     virtual void validateData() = 0;    // Validate results
     virtual void emitSignal() = 0;      // Send Qt signals
 
+    /**
+     * @brief Primary metric driving adaptive sampling
+     * Called after each sample with m_dataMutex held.
+     * @param value Latest value of the metric
+     * @param threshold Alert level the value is compared against
+     * @return false if the monitor has no adaptive metric (default)
+     */
+    virtual bool adaptiveMetric(double* value, double* threshold) const;
+
+    /**
+     * @brief Estimate of the memory the monitor retains (history, buffers)
+     * Called after each sample with m_dataMutex held. Default: 0.
+     */
+    virtual qint64 memoryFootprint() const;
+
     // Utility methods
     void updateTimestamp();
+    bool invokeInOwnerThread(const std::function<void()>& call);
     bool isDataState(int maxAgeMs = 5000) const;
 
+    // Demand tracking (may run in any thread, with Qt internals locked)
+    void connectNotify(const QMetaMethod& signal) override;
+    void disconnectNotify(const QMetaMethod& signal) override;
+
     // Thread safety
     mutable QMutex m_dataMutex;
 
@@ -63,14 +259,61 @@ signals:
     void monitoringStarted();
     void monitoringStopped();
     void dataUpdated();
+    void updateIntervalChanged(int intervalMs);
+    void parkedChanged(bool parked);
     void errorOccurred(const QString& error);
 
 private:
+    friend class MonitorSubscription;
+
+    bool isDemandSignal(const QMetaMethod& signal) const;
+    int dataConnectionCount() const;
+    void addSubscribers(int delta);
+    void requestDemandUpdate();
+    void updateDemand();
+
+    void applyInterval(int intervalMs);
+    int adaptInterval();
+    void recordLatency(const qint64 (&phaseNs)[TickLatencyStats::PhaseCount], qint64 startNs);
+    void dumpLatencyStats();
+    int recordOverhead(qint64 cpuNs, qint64 memoryBytes);
+
     QTimer* m_updateTimer;
-    bool m_isMonitoring;
-    bool m_isPaused;
-    int m_updateInterval;
-    QDateTime m_lastUpdateTime;
+    std::atomic<bool> m_isMonitoring;
+    std::atomic<bool> m_isPaused;
+    std::atomic<int> m_updateInterval;      // Effective interval
+    std::atomic<int> m_configuredInterval;  // Interval set by the user
+    bool m_externallyScheduled;
+    qint64 m_lastUpdateNs;
+
+    // Adaptive sampling (owner thread, policy guarded by m_dataMutex)
+    AdaptiveSamplingPolicy m_adaptivePolicy;
+    double m_lastAdaptiveValue;
+    bool m_hasAdaptiveValue;
+    int m_calmSamples;
+
+    // Tick latency (recorded in the owner thread under m_statsMutex)
+    mutable QMutex m_statsMutex;
+    LatencyHistogram m_phaseLatency[TickLatencyStats::PhaseCount];
+    quint64 m_missedDeadlines;
+    quint64 m_overruns;
+    std::atomic<qint64> m_lastTickStartNs;  // 0 after start/resume: no gap check
+    std::atomic<int> m_latencyDumpIntervalMs;
+    qint64 m_lastDumpNs;
+
+    // Self overhead and CPU budget (guarded by m_statsMutex)
+    qint64 m_cpuTimeNs;
+    double m_tickCpuNs;                     // Smoothed CPU cost per tick
+    qint64 m_memoryBytes;
+    quint64 m_overheadTicks;
+    double m_cpuBudgetPercent;
+    int m_budgetIntervalMs;
+
+    // Demand tracking
+    std::atomic<int> m_subscriptions;       // subscribe() handles
+    std::atomic<int> m_ownerConnections;    // Plumbing, not demand
+    std::atomic<bool> m_demandDriven;
+    std::atomic<bool> m_isParked;
 };
 
 #endif // BASEMONITOR_H
@@ -0,0 +1,31 @@
+/**
+ * @file coalescingmailbox.cpp
+ * @brief Mailbox event plumbing
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#include "coalescingmailbox.h"
+
+MailboxBase::MailboxBase(QObject *parent)
+    : QObject(parent)
+    , m_posted(0)
+    , m_delivered(0)
+    , m_dropped(0)
+{
+}
+
+QEvent::Type MailboxBase::deliveryEventType()
+{
+    static const QEvent::Type type = static_cast<QEvent::Type>(QEvent::registerEventType());
+    return type;
+}
+
+bool MailboxBase::event(QEvent *event)
+{
+    if (event->type() == deliveryEventType()) {
+        deliver();
+        return true;
+    }
+    return QObject::event(event);
+}
@@ -0,0 +1,123 @@
+/**
+ * @file coalescingmailbox.h
+ * @brief Latest-value-wins cross-thread delivery with a dropped counter
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#ifndef COALESCINGMAILBOX_H
+#define COALESCINGMAILBOX_H
+
+#include <QObject>
+#include <QEvent>
+#include <QMutex>
+#include <QCoreApplication>
+#include <atomic>
+#include <functional>
+
+/**
+ * @brief Non-template part of CoalescingMailbox (event plumbing, counters)
+ */
+class MailboxBase : public QObject
+{
+    Q_OBJECT
+public:
+    explicit MailboxBase(QObject *parent = nullptr);
+
+    // Statistics (any thread)
+    quint64 postedCount() const { return m_posted; }
+    quint64 deliveredCount() const { return m_delivered; }
+    quint64 droppedCount() const { return m_dropped; }
+
+protected:
+    bool event(QEvent* event) override;
+    virtual void deliver() = 0;
+
+    static QEvent::Type deliveryEventType();
+
+    std::atomic<quint64> m_posted;
+    std::atomic<quint64> m_delivered;
+    std::atomic<quint64> m_dropped;
+};
+
+/**
+ * @brief One-slot mailbox between a producer thread and a consumer
+ *
+ * A queued connection copies every emission into the consumer's event
+ * queue; a stalled consumer (busy GUI, slow exporter) accumulates one
+ * full CPUData per tick. The mailbox keeps only the latest value:
+ * post() overwrites an undelivered value (counted as dropped) and at
+ * most one delivery event is queued. Memory stays bounded at one T
+ * plus one event per consumer, however long the stall.
+ *
+ * The mailbox lives in the consumer's thread; the handler runs there.
+ * post() and attach()ed signals may fire from any thread.
+ */
+template <typename T>
+class CoalescingMailbox : public MailboxBase
+{
+public:
+    using Handler = std::function<void(const T&)>;
+
+    explicit CoalescingMailbox(Handler handler, QObject *parent = nullptr)
+        : MailboxBase(parent)
+        , m_handler(std::move(handler))
+        , m_hasPending(false)
+    {
+    }
+
+    /**
+     * @brief Feed a signal into the mailbox instead of a queued connection
+     * The connection is direct (runs in the emitting thread) and goes
+     * away with the mailbox.
+     */
+    template <typename Sender, typename Signal>
+    QMetaObject::Connection attach(const Sender* sender, Signal signal)
+    {
+        return QObject::connect(sender, signal, this, [this](const T& value) { post(value); },
+                                Qt::DirectConnection);
+    }
+
+    /**
+     * @brief Store value for the consumer, replacing an undelivered one
+     */
+    void post(const T& value)
+    {
+        ++m_posted;
+        {
+            QMutexLocker locker(&m_mutex);
+            m_latest = value;
+            if (m_hasPending) {
+                // Delivery event already queued, it will carry this value
+                ++m_dropped;
+                return;
+            }
+            m_hasPending = true;
+        }
+        QCoreApplication::postEvent(this, new QEvent(deliveryEventType()));
+    }
+
+protected:
+    void deliver() override
+    {
+        T value;
+        {
+            QMutexLocker locker(&m_mutex);
+            if (!m_hasPending) return;
+            value = m_latest;
+            m_hasPending = false;
+        }
+
+        // Outside the lock, the handler may take its time
+        ++m_delivered;
+        m_handler(value);
+    }
+
+private:
+    Handler m_handler;
+    QMutex m_mutex;
+    T m_latest;
+    bool m_hasPending;
+};
+
+#endif // COALESCINGMAILBOX_H
@@ -0,0 +1,296 @@
+/**
+ * @file samplingscheduler.cpp
+ * @brief Single-timer, phase-aligned scheduler implementation
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#include "samplingscheduler.h"
+#include "basemonitor.h"
+#include "core/sampleclock.h"
+
+#include <QDebug>
+#include <QSocketNotifier>
+#include <QThread>
+#include <QTimer>
+#include <cerrno>
+#include <cstring>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <sys/timerfd.h>
+#define SAMPLINGSCHEDULER_HAVE_TIMERFD 1
+#endif
+
+SamplingScheduler::SamplingScheduler(int baseTickMs, QObject *parent)
+    : QObject(parent)
+    , m_baseTickMs(qMax(1, baseTickMs))
+    , m_startNs(0)
+    , m_isRunning(false)
+    , m_timerFd(-1)
+    , m_notifier(nullptr)
+    , m_fallbackTimer(nullptr)
+    , m_wakeupCount(0)
+    , m_missedTicks(0)
+{
+}
+
+SamplingScheduler::~SamplingScheduler()
+{
+    // Destroyed in its own thread (DataManager moves it back first)
+    m_isRunning = false;
+    delete m_notifier;
+    if (m_timerFd >= 0) {
+        ::close(m_timerFd);
+    }
+}
+
+// ===================================================================
+// MONITOR REGISTRATION
+// ===================================================================
+
+void SamplingScheduler::addMonitor(BaseMonitor *monitor)
+{
+    if (!monitor) return;
+    if (invokeInOwnerThread([this, monitor] { addMonitor(monitor); })) return;
+
+    for (const Entry& entry : m_entries) {
+        if (entry.monitor == monitor) return;
+    }
+
+    const qint64 period = periodTicks(monitor);
+    Entry entry;
+    entry.monitor = monitor;
+    entry.nextTick = m_isRunning ? (currentTick() / period + 1) * period : period;
+    m_entries.append(entry);
+
+    connect(monitor, &BaseMonitor::updateIntervalChanged, this, &SamplingScheduler::onMonitorRescheduled);
+    connect(monitor, &BaseMonitor::parkedChanged, this, &SamplingScheduler::onMonitorRescheduled);
+    connect(monitor, &QObject::destroyed, this, [this, monitor] {
+        for (int i = 0; i < m_entries.size(); ++i) {
+            if (m_entries[i].monitor == monitor) {
+                m_entries.remove(i);
+                break;
+            }
+        }
+    });
+    monitor->setExternallyScheduled(true);
+
+    if (m_isRunning) {
+        armNextDeadline();
+    }
+}
+
+void SamplingScheduler::removeMonitor(BaseMonitor *monitor)
+{
+    if (!monitor) return;
+    if (invokeInOwnerThread([this, monitor] { removeMonitor(monitor); })) return;
+
+    for (int i = 0; i < m_entries.size(); ++i) {
+        if (m_entries[i].monitor == monitor) {
+            m_entries.remove(i);
+            disconnect(monitor, nullptr, this, nullptr);
+            monitor->setExternallyScheduled(false);
+            break;
+        }
+    }
+
+    if (m_isRunning) {
+        armNextDeadline();
+    }
+}
+
+// ===================================================================
+// CONTROL
+// ===================================================================
+
+void SamplingScheduler::start()
+{
+    if (invokeInOwnerThread([this] { start(); })) return;
+    if (m_isRunning) return;
+
+#if defined(SAMPLINGSCHEDULER_HAVE_TIMERFD)
+    if (m_timerFd < 0 && !m_fallbackTimer) {
+        m_timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        if (m_timerFd >= 0) {
+            m_notifier = new QSocketNotifier(m_timerFd, QSocketNotifier::Read, this);
+            connect(m_notifier, &QSocketNotifier::activated, this, &SamplingScheduler::onTimerFired);
+        } else {
+            qWarning() << "timerfd_create failed:" << strerror(errno) << "- using QTimer";
+        }
+    }
+#endif
+
+    if (m_timerFd < 0 && !m_fallbackTimer) {
+        m_fallbackTimer = new QTimer(this);
+        m_fallbackTimer->setTimerType(Qt::PreciseTimer);
+        m_fallbackTimer->setSingleShot(true);
+        connect(m_fallbackTimer, &QTimer::timeout, this, &SamplingScheduler::onTimerFired);
+    }
+
+    // Tick 0 is now; every monitor first runs one period later, like
+    // a freshly started QTimer
+    m_startNs = SampleClock::nowNs();
+    for (Entry& entry : m_entries) {
+        entry.nextTick = periodTicks(entry.monitor);
+    }
+
+    m_isRunning = true;
+    if (m_notifier) m_notifier->setEnabled(true);
+    armNextDeadline();
+}
+
+void SamplingScheduler::stop()
+{
+    if (invokeInOwnerThread([this] { stop(); })) return;
+    if (!m_isRunning) return;
+
+    m_isRunning = false;
+
+#if defined(SAMPLINGSCHEDULER_HAVE_TIMERFD)
+    if (m_timerFd >= 0) {
+        itimerspec disarm = {};
+        timerfd_settime(m_timerFd, 0, &disarm, nullptr);
+    }
+#endif
+    if (m_notifier) m_notifier->setEnabled(false);
+    if (m_fallbackTimer) m_fallbackTimer->stop();
+}
+
+void SamplingScheduler::shutdown(QThread *targetThread)
+{
+    if (invokeInOwnerThread([this, targetThread] { shutdown(targetThread); })) return;
+
+    stop();
+    if (targetThread && targetThread != thread()) {
+        moveToThread(targetThread);
+    }
+}
+
+// ===================================================================
+// TICK DISPATCH
+// ===================================================================
+
+void SamplingScheduler::onTimerFired()
+{
+#if defined(SAMPLINGSCHEDULER_HAVE_TIMERFD)
+    if (m_timerFd >= 0) {
+        // Drain the expiration count, the tick number comes from the clock
+        quint64 expirations = 0;
+        ssize_t bytesRead = ::read(m_timerFd, &expirations, sizeof(expirations));
+        Q_UNUSED(bytesRead);
+    }
+#endif
+
+    if (!m_isRunning) return;
+    ++m_wakeupCount;
+
+    const qint64 tick = currentTick();
+    bool ranAny = false;
+
+    for (int i = 0; i < m_entries.size(); ++i) {
+        BaseMonitor* monitor = m_entries[i].monitor;
+        if (monitor->isParked() || m_entries[i].nextTick > tick) continue;
+
+        const qint64 period = periodTicks(monitor);
+
+        // Late wakeup: run once, skip the slots that already passed
+        m_missedTicks += static_cast<quint64>((tick - m_entries[i].nextTick) / period);
+        m_entries[i].nextTick = (tick / period + 1) * period;
+
+        monitor->sample();
+        ranAny = true;
+    }
+
+    if (ranAny) {
+        emit batchCompleted(static_cast<quint64>(tick));
+    }
+
+    armNextDeadline();
+}
+
+void SamplingScheduler::onMonitorRescheduled()
+{
+    BaseMonitor* monitor = qobject_cast<BaseMonitor*>(sender());
+    if (!monitor || !m_isRunning) return;
+
+    for (Entry& entry : m_entries) {
+        if (entry.monitor == monitor) {
+            const qint64 period = periodTicks(monitor);
+            entry.nextTick = (currentTick() / period + 1) * period;
+            break;
+        }
+    }
+
+    armNextDeadline();
+}
+
+// ===================================================================
+// HELPERS
+// ===================================================================
+
+bool SamplingScheduler::invokeInOwnerThread(const std::function<void()> &call)
+{
+    QThread* owner = thread();
+    if (owner == QThread::currentThread()) {
+        return false;
+    }
+
+    if (!owner->isRunning()) {
+        qWarning() << "SamplingScheduler: owner thread not running, call dropped";
+        return true;
+    }
+
+    QMetaObject::invokeMethod(this, call, Qt::BlockingQueuedConnection);
+    return true;
+}
+
+qint64 SamplingScheduler::periodTicks(const BaseMonitor *monitor) const
+{
+    // Intervals round to the nearest multiple of the base tick
+    return qMax<qint64>(1, (monitor->getUpdateInterval() + m_baseTickMs / 2) / m_baseTickMs);
+}
+
+qint64 SamplingScheduler::currentTick() const
+{
+    return (SampleClock::nowNs() - m_startNs) / (static_cast<qint64>(m_baseTickMs) * 1000000LL);
+}
+
+void SamplingScheduler::armNextDeadline()
+{
+    if (!m_isRunning) return;
+
+    qint64 nextTick = -1;
+    for (const Entry& entry : m_entries) {
+        if (entry.monitor->isParked()) continue;
+        nextTick = (nextTick < 0) ? entry.nextTick : qMin(nextTick, entry.nextTick);
+    }
+
+    // Nothing active: no wakeups until a monitor unparks or is added
+    if (nextTick < 0) {
+#if defined(SAMPLINGSCHEDULER_HAVE_TIMERFD)
+        if (m_timerFd >= 0) {
+            itimerspec disarm = {};
+            timerfd_settime(m_timerFd, 0, &disarm, nullptr);
+        }
+#endif
+        if (m_fallbackTimer) m_fallbackTimer->stop();
+        return;
+    }
+    const qint64 deadlineNs = m_startNs + nextTick * m_baseTickMs * 1000000LL;
+
+#if defined(SAMPLINGSCHEDULER_HAVE_TIMERFD)
+    if (m_timerFd >= 0) {
+        // Absolute deadline: no drift, a deadline already in the past
+        // fires immediately
+        itimerspec spec = {};
+        spec.it_value.tv_sec = deadlineNs / 1000000000LL;
+        spec.it_value.tv_nsec = deadlineNs % 1000000000LL;
+        timerfd_settime(m_timerFd, TFD_TIMER_ABSTIME, &spec, nullptr);
+        return;
+    }
+#endif
+
+    const qint64 remainingMs = (deadlineNs - SampleClock::nowNs() + 999999) / 1000000;
+    m_fallbackTimer->start(static_cast<int>(qMax<qint64>(0, remainingMs)));
+}
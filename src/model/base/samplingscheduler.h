@@ -0,0 +1,99 @@
+/**
+ * @file samplingscheduler.h
+ * @brief Single-timer, phase-aligned scheduler for all monitors
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#ifndef SAMPLINGSCHEDULER_H
+#define SAMPLINGSCHEDULER_H
+
+#include <QObject>
+#include <QVector>
+#include <functional>
+#include "core/constants.h"
+
+class BaseMonitor;
+class QSocketNotifier;
+class QTimer;
+
+/**
+ * @brief Drives every registered monitor from one CLOCK_MONOTONIC timerfd
+ *
+ * Time is divided into base ticks counted from start(). A monitor with
+ * update interval I runs every round(I / baseTick) ticks, on tick
+ * numbers that are multiples of its period, so monitors sharing a
+ * period always run in the same wakeup. The timerfd is armed with an
+ * absolute deadline for the next tick where something is due, so idle
+ * ticks cost no wakeup and deadlines do not drift.
+ *
+ * Parked (demand-driven, unsubscribed) monitors are skipped and do not
+ * arm the timer; they are re-phased when they unpark.
+ *
+ * Lives in the same thread as its monitors (DataManager's collector).
+ * Falls back to a precise QTimer when timerfd is unavailable.
+ */
+class SamplingScheduler : public QObject
+{
+    Q_OBJECT
+public:
+    explicit SamplingScheduler(int baseTickMs = SCHEDULER_BASE_TICK, QObject *parent = nullptr);
+    ~SamplingScheduler();
+
+    // Monitor registration (monitors must live in the scheduler's thread)
+    void addMonitor(BaseMonitor* monitor);
+    void removeMonitor(BaseMonitor* monitor);
+
+    // Control interface (forwarded to the scheduler's thread)
+    void start();
+    void stop();
+    bool isRunning() const { return m_isRunning; }
+
+    /**
+     * @brief Stop and move to another thread before the current one quits
+     * @param targetThread Thread the scheduler will be destroyed in
+     */
+    void shutdown(QThread* targetThread);
+
+    int baseTick() const { return m_baseTickMs; }
+
+    // Statistics
+    quint64 wakeupCount() const { return m_wakeupCount; }
+    quint64 missedTickCount() const { return m_missedTicks; }
+
+signals:
+    /**
+     * @brief All monitors due on a tick have sampled
+     * @param tick Base tick number since start()
+     */
+    void batchCompleted(quint64 tick);
+
+private slots:
+    void onTimerFired();
+    void onMonitorRescheduled();
+
+private:
+    struct Entry {
+        BaseMonitor* monitor;
+        qint64 nextTick;
+    };
+
+    bool invokeInOwnerThread(const std::function<void()>& call);
+    qint64 periodTicks(const BaseMonitor* monitor) const;
+    qint64 currentTick() const;
+    void armNextDeadline();
+
+    QVector<Entry> m_entries;
+    int m_baseTickMs;
+    qint64 m_startNs;
+    bool m_isRunning;
+
+    int m_timerFd;
+    QSocketNotifier* m_notifier;
+    QTimer* m_fallbackTimer;
+
+    quint64 m_wakeupCount;
+    quint64 m_missedTicks;
+};
+
+#endif // SAMPLINGSCHEDULER_H
@@ -146,14 +146,14 @@ void AlertManager::checkCPUThresholds(const CPUData &data)
     }
 
     // Check temperature
-    if (data.temperature >= TEMP_CRITICAL_THRESHOLD && shouldCreateTempAlert(AlertSeverity::Critical)) {
-        AlertData alert = createTemperatureAlert(AlertSeverity::Critical, data.temperature);
+    if (data.maxTemperature >= TEMP_CRITICAL_THRESHOLD && shouldCreateTempAlert(AlertSeverity::Critical)) {
+        AlertData alert = createTemperatureAlert(AlertSeverity::Critical, data.maxTemperature);
         addAlert(alert);
         m_tempCriticalActive = true;
         m_lastTempAlert = QDateTime::currentDateTime();
     }
-    else if (data.temperature >= TEMP_WARNING_THRESHOLD && shouldCreateTempAlert(AlertSeverity::Warning)) {
-        AlertData alert = createTemperatureAlert(AlertSeverity::Warning, data.temperature);
+    else if (data.maxTemperature >= TEMP_WARNING_THRESHOLD && shouldCreateTempAlert(AlertSeverity::Warning)) {
+        AlertData alert = createTemperatureAlert(AlertSeverity::Warning, data.maxTemperature);
         addAlert(alert);
         m_tempWarningActive = true;
         m_lastTempAlert = QDateTime::currentDateTime();
@@ -6,25 +6,52 @@
 #include "datamanager.h"
 #include "model/monitors/cpumonitor.h"
 #include "model/monitors/memorymonitor.h"
+#include "model/monitors/networkmonitor.h"
+#include "model/monitors/storagemonitor.h"
+#include "model/monitors/systemloadmonitor.h"
+#include "model/monitors/processmonitor.h"
+#include "model/base/samplingscheduler.h"
+#include "model/base/coalescingmailbox.h"
 #include "alertmanager.h"
 #include "core/constants.h"
+#include "core/sampleclock.h"
 #include <QDebug>
+#include <QMetaMethod>
 
 DataManager::DataManager(QObject *parent)
     : QObject(parent)
-    , m_aggregationTimer(new QTimer(this))
+    , m_cpuMailbox(nullptr)
+    , m_memoryMailbox(nullptr)
+    , m_networkMailbox(nullptr)
+    , m_storageMailbox(nullptr)
+    , m_systemLoadMailbox(nullptr)
+    , m_processMailbox(nullptr)
+    , m_batchMailbox(nullptr)
+    , m_cpuAlertMailbox(nullptr)
+    , m_memoryAlertMailbox(nullptr)
+    , m_collectorThread(new QThread(this))
     , m_isInitialized(false)
     , m_isRunning(false)
     , m_isPaused(false)
+    , m_demandDriven(false)
     , m_updateInterval(UPDATE_INTERVAL)
 {
-    connect(m_aggregationTimer, &QTimer::timeout, this, &DataManager::aggregateSystemData);
-    m_aggregationTimer->setSingleShot(false);
+    // Types crossing the collector thread boundary in queued signals
+    qRegisterMetaType<CPUData>("CPUData");
+    qRegisterMetaType<MemoryData>("MemoryData");
+    qRegisterMetaType<NetworkData>("NetworkData");
+    qRegisterMetaType<StorageData>("StorageData");
+    qRegisterMetaType<SystemData>("SystemData");
+    qRegisterMetaType<ProcessListData>("ProcessListData");
+    qRegisterMetaType<SystemOverview>("SystemOverview");
+
+    m_collectorThread->setObjectName("Collector");
 }
 
 DataManager::~DataManager()
 {
     stop();
+    shutdownCollector();
 }
 
 void DataManager::initialize()
@@ -32,56 +59,39 @@ void DataManager::initialize()
     if (m_isInitialized) return;
 
     try {
-        // Create monitor intances
-        m_cpuMonitor = std::make_unique<CPUMonitor>(this);
-        m_memoryMonitor = std::make_unique<MemoryMonitor>(this);
+        // Create monitor intances. Monitors have no parent: they move to
+        // the collector thread and are owned by the unique_ptrs
+        m_cpuMonitor = std::make_unique<CPUMonitor>();
+        m_memoryMonitor = std::make_unique<MemoryMonitor>();
+        m_networkMonitor = std::make_unique<NetworkMonitor>();
+        m_storageMonitor = std::make_unique<StorageMonitor>();
+        m_systemLoadMonitor = std::make_unique<SystemLoadMonitor>();
+        m_processMonitor = std::make_unique<ProcessMonitor>();
         m_alertManager = std::make_unique<AlertManager>(this);
+        m_scheduler = std::make_unique<SamplingScheduler>();
 
-        // Connect signalsvvvvvv    if (m_isInitialized) return;
-
-        try {
-            // Create monitor intances
-            m_cpuMonitor = std::make_unique<CPUMonitor>(this);
-            m_memoryMonitor = std::make_unique<MemoryMonitor>(this);
-            m_alertManager = std::make_unique<AlertManager>(this);
-
-            // Connect signals
-            connectMonitorSignals();
-
-            // Set update intervals
-            m_cpuMonitor->setUpdateInterval(m_updateInterval);
-            m_memoryMonitor->setUpdateInterval(m_updateInterval);
-
-            m_isInitialized = true;
-            emit initializationComplete();
-        } catch (const std::exception &e) {
-            emit errorOccurred(QString("Initialization failed: %1").arg(e.what()));
-        }    if (m_isInitialized) return;
-
-        try {
-            // Create monitor intances
-            m_cpuMonitor = std::make_unique<CPUMonitor>(this);
-            m_memoryMonitor = std::make_unique<MemoryMonitor>(this);
-            m_alertManager = std::make_unique<AlertManager>(this);
-
-            // Connect signals
-            connectMonitorSignals();
-
-            // Set update intervals
-            m_cpuMonitor->setUpdateInterval(m_updateInterval);
-            m_memoryMonitor->setUpdateInterval(m_updateInterval);
-
-            m_isInitialized = true;
-            emit initializationComplete();
-        } catch (const std::exception &e) {
-            emit errorOccurred(QString("Initialization failed: %1").arg(e.what()));
-        }
+        // Connect signals (queued across the thread boundary). This
+        // wiring is plumbing, only later consumers count as demand
         connectMonitorSignals();
+        for (BaseMonitor* monitor : monitors()) {
+            monitor->markOwnerConnections();
+            monitor->setDemandDriven(m_demandDriven);
+        }
+        syncOverviewSubscriptions();
 
-        // Set update intervals
+        // CPU and memory follow the configured interval, the other
+        // monitors keep their own
         m_cpuMonitor->setUpdateInterval(m_updateInterval);
         m_memoryMonitor->setUpdateInterval(m_updateInterval);
 
+        // One timer for all monitors, sampling on the collector thread
+        for (BaseMonitor* monitor : monitors()) {
+            m_scheduler->addMonitor(monitor);
+            monitor->moveToThread(m_collectorThread);
+        }
+        m_scheduler->moveToThread(m_collectorThread);
+        m_collectorThread->start();
+
         m_isInitialized = true;
         emit initializationComplete();
     } catch (const std::exception &e) {
@@ -99,11 +109,12 @@ void DataManager::start()
 
     try {
         // Start all monitors
-        m_cpuMonitor->startMonitoring();
-        m_memoryMonitor->startMonitoring();
+        for (BaseMonitor* monitor : monitors()) {
+            monitor->startMonitoring();
+        }
 
-        // Start aggreation timer
-        m_aggregationTimer->start(m_updateInterval);
+        // Start the shared sampling timer
+        m_scheduler->start();
 
         m_isRunning = true;
         m_isPaused = false;
@@ -118,12 +129,13 @@ void DataManager::stop()
 {
     if (!m_isRunning) return;
 
-    // Stop aggregation timer
-    m_aggregationTimer->stop();
+    // Stop the shared sampling timer
+    if (m_scheduler) m_scheduler->stop();
 
     // Stop all monitors
-    if (m_cpuMonitor) m_cpuMonitor->stopMonitoring();
-    if (m_memoryMonitor) m_memoryMonitor->stopMonitoring();
+    for (BaseMonitor* monitor : monitors()) {
+        monitor->stopMonitoring();
+    }
 
     m_isRunning = false;
     m_isPaused = false;
@@ -134,9 +146,10 @@ void DataManager::pause()
 {
     if (!m_isRunning || m_isPaused) return;
 
-    m_cpuMonitor->pauseMonitoring();
-    m_memoryMonitor->pauseMonitoring();
-    m_aggregationTimer->stop();
+    for (BaseMonitor* monitor : monitors()) {
+        monitor->pauseMonitoring();
+    }
+    m_scheduler->stop();
 
     m_isPaused = true;
     emit monitoringStateChanged(false);
@@ -146,9 +159,10 @@ void DataManager::resume()
 {
     if (!m_isRunning || !m_isPaused) return;
 
-    m_cpuMonitor->resumeMonitoring();
-    m_memoryMonitor->resumeMonitoring();
-    m_aggregationTimer->start(m_updateInterval);
+    for (BaseMonitor* monitor : monitors()) {
+        monitor->resumeMonitoring();
+    }
+    m_scheduler->start();
 
     m_isPaused = false;
     emit monitoringStateChanged(true);
@@ -162,23 +176,45 @@ SystemOverview DataManager::getCurrentSystemData() const
 
 CPUData DataManager::getCurrentCPUData() const
 {
-    if (m_cpuMonitor) {
-        return m_cpuMonitor->getCurrentData();
-    }
-    return CPUData();
+    // Latest sample delivered by queued signal; never waits for a
+    // collection in progress on the collector thread
+    QMutexLocker locker(&m_dataMutex);
+    return m_currentOverview.cpu;
 }
 
 MemoryData DataManager::getCurrentMemoryData() const
 {
-    if (m_memoryMonitor) {
-        return m_memoryMonitor->getCurrentData();
-    }
-    return MemoryData();
+    QMutexLocker locker(&m_dataMutex);
+    return m_currentOverview.memory;
+}
+
+NetworkData DataManager::getCurrentNetworkData() const
+{
+    QMutexLocker locker(&m_dataMutex);
+    return m_currentOverview.network;
+}
+
+StorageData DataManager::getCurrentStorageData() const
+{
+    QMutexLocker locker(&m_dataMutex);
+    return m_currentOverview.storage;
+}
+
+SystemData DataManager::getCurrentLoadData() const
+{
+    QMutexLocker locker(&m_dataMutex);
+    return m_currentOverview.system;
+}
+
+ProcessListData DataManager::getCurrentProcessData() const
+{
+    QMutexLocker locker(&m_dataMutex);
+    return m_currentOverview.processes;
 }
 
 void DataManager::setUpdateInterval(int intervalMs)
 {
-    m_updateInterval = qMax(100, intervalMs);
+    m_updateInterval = qMax(MIN_UPDATE_INTERVAL, intervalMs);
 
     if (m_cpuMonitor) {
         m_cpuMonitor->setUpdateInterval(m_updateInterval);
@@ -186,10 +222,6 @@ void DataManager::setUpdateInterval(int intervalMs)
     if (m_memoryMonitor) {
         m_memoryMonitor->setUpdateInterval(m_updateInterval);
     }
-
-    if (m_isRunning) {
-        m_aggregationTimer->setInterval(m_updateInterval);
-    }
 }
 
 void DataManager::setGlobalPaused(bool paused)
@@ -202,6 +234,65 @@ void DataManager::setGlobalPaused(bool paused)
     }
 }
 
+void DataManager::setAdaptiveSampling(bool enabled)
+{
+    // Default policy: 100ms on spikes or near the warning level,
+    // backing off to 10s while the signal stays flat
+    AdaptiveSamplingPolicy policy;
+    policy.enabled = enabled;
+
+    // Monitors without an adaptive metric keep their interval
+    for (BaseMonitor* monitor : monitors()) {
+        monitor->setAdaptivePolicy(policy);
+    }
+}
+
+void DataManager::setDemandDriven(bool enabled)
+{
+    m_demandDriven = enabled;
+
+    for (BaseMonitor* monitor : monitors()) {
+        monitor->setDemandDriven(enabled);
+    }
+}
+
+void DataManager::setMonitorCpuBudget(double percentOfCore)
+{
+    for (BaseMonitor* monitor : monitors()) {
+        monitor->setCpuBudget(percentOfCore);
+    }
+}
+
+void DataManager::connectNotify(const QMetaMethod &signal)
+{
+    // May run in another thread with the connection lock held: defer
+    if (signal == QMetaMethod::fromSignal(&DataManager::systemDataUpdated)) {
+        QMetaObject::invokeMethod(this, [this] { syncOverviewSubscriptions(); }, Qt::QueuedConnection);
+    }
+}
+
+void DataManager::disconnectNotify(const QMetaMethod &signal)
+{
+    if (!signal.isValid() || signal == QMetaMethod::fromSignal(&DataManager::systemDataUpdated)) {
+        QMetaObject::invokeMethod(this, [this] { syncOverviewSubscriptions(); }, Qt::QueuedConnection);
+    }
+}
+
+void DataManager::syncOverviewSubscriptions()
+{
+    if (!m_cpuMonitor || !m_memoryMonitor) return;
+
+    // One subscription per monitor while anyone listens to the overview
+    const bool wanted = receivers(SIGNAL(systemDataUpdated(SystemOverview))) > 0;
+    if (wanted && m_overviewSubscriptions.empty()) {
+        for (BaseMonitor* monitor : monitors()) {
+            m_overviewSubscriptions.push_back(monitor->subscribe());
+        }
+    } else if (!wanted) {
+        m_overviewSubscriptions.clear();
+    }
+}
+
 void DataManager::onCPUDataUpdated(const CPUData &data)
 {
     QMutexLocker locker(&m_dataMutex);
@@ -214,6 +305,30 @@ void DataManager::onMemoryDataUpdated(const MemoryData &data)
     m_currentOverview.memory = data;
 }
 
+void DataManager::onNetworkDataUpdated(const NetworkData &data)
+{
+    QMutexLocker locker(&m_dataMutex);
+    m_currentOverview.network = data;
+}
+
+void DataManager::onStorageDataUpdated(const StorageData &data)
+{
+    QMutexLocker locker(&m_dataMutex);
+    m_currentOverview.storage = data;
+}
+
+void DataManager::onSystemLoadUpdated(const SystemData &data)
+{
+    QMutexLocker locker(&m_dataMutex);
+    m_currentOverview.system = data;
+}
+
+void DataManager::onProcessDataUpdated(const ProcessListData &data)
+{
+    QMutexLocker locker(&m_dataMutex);
+    m_currentOverview.processes = data;
+}
+
 void DataManager::aggregateSystemData()
 {
     updateSystemOverview();
@@ -226,22 +341,99 @@ void DataManager::aggregateSystemData()
 
 void DataManager::connectMonitorSignals()
 {
-    // Connect CPU monitor
-    connect(m_cpuMonitor.get(),&CPUMonitor::cpuDataUpdated, this, &DataManager::onCPUDataUpdated);
+    // Every consumer gets its own mailbox: a slow consumer only ever
+    // has the latest value waiting, never a backlog of copies
+    m_cpuMailbox = new CoalescingMailbox<CPUData>(
+        [this](const CPUData& data) { onCPUDataUpdated(data); }, this);
+    m_cpuMailbox->attach(m_cpuMonitor.get(), &CPUMonitor::cpuDataUpdated);
+
+    m_memoryMailbox = new CoalescingMailbox<MemoryData>(
+        [this](const MemoryData& data) { onMemoryDataUpdated(data); }, this);
+    m_memoryMailbox->attach(m_memoryMonitor.get(), &MemoryMonitor::memoryDataUpdated);
+
+    m_networkMailbox = new CoalescingMailbox<NetworkData>(
+        [this](const NetworkData& data) { onNetworkDataUpdated(data); }, this);
+    m_networkMailbox->attach(m_networkMonitor.get(), &NetworkMonitor::networkDataUpdated);
+
+    m_storageMailbox = new CoalescingMailbox<StorageData>(
+        [this](const StorageData& data) { onStorageDataUpdated(data); }, this);
+    m_storageMailbox->attach(m_storageMonitor.get(), &StorageMonitor::storageDataUpdated);
+
+    m_systemLoadMailbox = new CoalescingMailbox<SystemData>(
+        [this](const SystemData& data) { onSystemLoadUpdated(data); }, this);
+    m_systemLoadMailbox->attach(m_systemLoadMonitor.get(), &SystemLoadMonitor::systemDataUpdated);
+
+    m_processMailbox = new CoalescingMailbox<ProcessListData>(
+        [this](const ProcessListData& data) { onProcessDataUpdated(data); }, this);
+    m_processMailbox->attach(m_processMonitor.get(), &ProcessMonitor::processDataUpdated);
+
+    // Aggregate once per scheduler batch, after the monitors' updates
+    // (posted after them, so delivered after them)
+    m_batchMailbox = new CoalescingMailbox<quint64>(
+        [this](quint64) { aggregateSystemData(); }, this);
+    m_batchMailbox->attach(m_scheduler.get(), &SamplingScheduler::batchCompleted);
+
+    // Alerts check the latest sample
+    AlertManager* alerts = m_alertManager.get();
+    m_cpuAlertMailbox = new CoalescingMailbox<CPUData>(
+        [alerts](const CPUData& data) { alerts->checkCPUThresholds(data); }, this);
+    m_cpuAlertMailbox->attach(m_cpuMonitor.get(), &CPUMonitor::cpuDataUpdated);
+
+    m_memoryAlertMailbox = new CoalescingMailbox<MemoryData>(
+        [alerts](const MemoryData& data) { alerts->checkMemoryThresholds(data); }, this);
+    m_memoryAlertMailbox->attach(m_memoryMonitor.get(), &MemoryMonitor::memoryDataUpdated);
+}
+
+quint64 DataManager::droppedUpdateCount() const
+{
+    quint64 dropped = 0;
+    const MailboxBase* mailboxes[] = {
+        m_cpuMailbox, m_memoryMailbox, m_networkMailbox, m_storageMailbox, m_systemLoadMailbox,
+        m_processMailbox, m_batchMailbox, m_cpuAlertMailbox, m_memoryAlertMailbox
+    };
+    for (const MailboxBase* mailbox : mailboxes) {
+        if (mailbox) dropped += mailbox->droppedCount();
+    }
+    return dropped;
+}
 
-    // Connect Memory monitor
-    connect(m_memoryMonitor.get(), &MemoryMonitor::memoryDataUpdated, this, &DataManager::onMemoryDataUpdated);
+void DataManager::shutdownCollector()
+{
+    if (!m_collectorThread->isRunning()) return;
 
-    // Connect monitor to alert manager
-    connect(m_cpuMonitor.get(), &CPUMonitor::cpuDataUpdated, m_alertManager.get(), &AlertManager::checkCPUThresholds);
+    // Stop timers in the collector thread and bring the objects back,
+    // so the unique_ptrs destroy them in this thread after it exits
+    if (m_scheduler) m_scheduler->shutdown(thread());
+    for (BaseMonitor* monitor : monitors()) {
+        monitor->shutdown(thread());
+    }
 
-    connect(m_memoryMonitor.get(), &MemoryMonitor::memoryDataUpdated, m_alertManager.get(), &AlertManager::checkMemoryThresholds);
+    m_collectorThread->quit();
+    m_collectorThread->wait();
 }
 
 void DataManager::updateSystemOverview()
 {
+    // Stats mutexes only, never blocks on a tick in progress
+    MonitorOverhead overhead;
+    for (BaseMonitor* monitor : monitors()) {
+        overhead += monitor->getOverhead();
+    }
+
     QMutexLocker locker(&m_dataMutex);
-    m_currentOverview.timestamp = QDateTime::currentDateTime();
+    m_currentOverview.overhead = overhead;
+    m_currentOverview.timestampNs = SampleClock::nowNs();
 }
 
-
+std::vector<BaseMonitor*> DataManager::monitors() const
+{
+    std::vector<BaseMonitor*> list;
+    BaseMonitor* all[] = {
+        m_cpuMonitor.get(), m_memoryMonitor.get(), m_networkMonitor.get(), m_storageMonitor.get(),
+        m_systemLoadMonitor.get(), m_processMonitor.get()
+    };
+    for (BaseMonitor* monitor : all) {
+        if (monitor) list.push_back(monitor);
+    }
+    return list;
+}
@@ -9,15 +9,24 @@
 #define DATAMANAGER_H
 
 #include <QObject>
-#include <QTimer>
+#include <QThread>
 #include <QMutex>
 #include <memory>
+#include <vector>
 #include "core/types.h"
+#include "model/base/basemonitor.h"
 
 // Forward declarations
 class CPUMonitor;
 class MemoryMonitor;
+class NetworkMonitor;
+class StorageMonitor;
+class SystemLoadMonitor;
+class ProcessMonitor;
 class AlertManager;
+class SamplingScheduler;
+class MailboxBase;
+template <typename T> class CoalescingMailbox;
 
 /**
  * @brief System overview data structure
@@ -26,15 +35,20 @@ class AlertManager;
 struct SystemOverview {
     CPUData cpu;
     MemoryData memory;
-    QDateTime timestamp;
+    NetworkData network;
+    StorageData storage;
+    SystemData system;          // Load, tasks, uptime, static facts
+    ProcessListData processes;  // Process totals and top lists
+    MonitorOverhead overhead;   // Combined cost of the monitors themselves
+    qint64 timestampNs;     // Aggregation time (SampleClock, monotonic)
 
     bool isValid() const {
         return cpu.isValid() && memory.isValid();
     }
 
-    SystemOverview() {
-        timestamp = QDateTime::currentDateTime();
-    }
+    QDateTime timestamp() const { return SampleClock::toDateTime(timestampNs); }
+
+    SystemOverview() : timestampNs(0) {}
 };
 
 Q_DECLARE_METATYPE(SystemOverview)
@@ -42,6 +56,20 @@ Q_DECLARE_METATYPE(SystemOverview)
 /**
  * @brief Central data coordination and management
  * Manages all monitors and provides unified data access
+ *
+ * Monitors sample on a dedicated collector thread so slow /proc and
+ * sysfs reads never stall the GUI event loop. Their results arrive here
+ * through one CoalescingMailbox per consumer (aggregation, alerts):
+ * during a GUI stall only the latest sample waits, older ones are
+ * counted as dropped. DataManager and AlertManager live in the thread
+ * that created the DataManager. One SamplingScheduler drives all
+ * monitors, and its batchCompleted signal triggers aggregation.
+ *
+ * Demand-driven mode: aggregation and alert wiring do not count as
+ * demand. Connections to systemDataUpdated subscribe every monitor;
+ * pages showing one metric subscribe its monitor directly
+ * (getCPUMonitor()->subscribe()). Unsubscribed monitors park, and
+ * their alerts pause with them.
  */
 
 class DataManager : public QObject
@@ -62,19 +90,31 @@ public:
     SystemOverview getCurrentSystemData() const;
     CPUData getCurrentCPUData() const;
     MemoryData getCurrentMemoryData() const;
+    NetworkData getCurrentNetworkData() const;
+    StorageData getCurrentStorageData() const;
+    SystemData getCurrentLoadData() const;
+    ProcessListData getCurrentProcessData() const;
 
     // Status
+    quint64 droppedUpdateCount() const;     // Samples superseded before delivery
     bool isRunning() const { return m_isRunning; }
     bool isPaused() const { return m_isPaused; }
     bool isInitialized() const { return m_isInitialized; }
 
     // Configuration
-    void setUpdateInterval(int intervalMs);
+    void setUpdateInterval(int intervalMs);     // CPU and memory; slower monitors keep theirs
     void setGlobalPaused(bool paused);
+    void setAdaptiveSampling(bool enabled);     // Volatility-driven intervals
+    void setDemandDriven(bool enabled);         // Park unsubscribed monitors
+    void setMonitorCpuBudget(double percentOfCore); // Per monitor, 0 = none
 
     // Monitor access
     CPUMonitor* getCPUMonitor() const { return m_cpuMonitor.get(); }
     MemoryMonitor* getMemoryMonitor() const { return m_memoryMonitor.get(); }
+    NetworkMonitor* getNetworkMonitor() const { return m_networkMonitor.get(); }
+    StorageMonitor* getStorageMonitor() const { return m_storageMonitor.get(); }
+    SystemLoadMonitor* getSystemLoadMonitor() const { return m_systemLoadMonitor.get(); }
+    ProcessMonitor* getProcessMonitor() const { return m_processMonitor.get(); }
     AlertManager* getAlertManager() const { return m_alertManager.get(); }
 
 signals:
@@ -83,29 +123,59 @@ signals:
     void initializationComplete();
     void errorOccurred(const QString& error);
 
+protected:
+    // Overview consumers subscribe to every monitor
+    void connectNotify(const QMetaMethod& signal) override;
+    void disconnectNotify(const QMetaMethod& signal) override;
+
 private slots:
     void onCPUDataUpdated(const CPUData& data);
     void onMemoryDataUpdated(const MemoryData& data);
+    void onNetworkDataUpdated(const NetworkData& data);
+    void onStorageDataUpdated(const StorageData& data);
+    void onSystemLoadUpdated(const SystemData& data);
+    void onProcessDataUpdated(const ProcessListData& data);
     void aggregateSystemData();
 
 private:
     void connectMonitorSignals();
+    void shutdownCollector();
     void updateSystemOverview();
+    void syncOverviewSubscriptions();
+    std::vector<BaseMonitor*> monitors() const;     // Every existing monitor
 
-    // Monitor instances
+    // Monitor instances (parentless, running in m_collectorThread)
     std::unique_ptr<CPUMonitor> m_cpuMonitor;
     std::unique_ptr<MemoryMonitor> m_memoryMonitor;
+    std::unique_ptr<NetworkMonitor> m_networkMonitor;
+    std::unique_ptr<StorageMonitor> m_storageMonitor;
+    std::unique_ptr<SystemLoadMonitor> m_systemLoadMonitor;
+    std::unique_ptr<ProcessMonitor> m_processMonitor;
     std::unique_ptr<AlertManager> m_alertManager;
+    std::unique_ptr<SamplingScheduler> m_scheduler;
+    std::vector<MonitorSubscription> m_overviewSubscriptions;
+
+    // Latest-value delivery from the collector thread (children of this)
+    CoalescingMailbox<CPUData>* m_cpuMailbox;
+    CoalescingMailbox<MemoryData>* m_memoryMailbox;
+    CoalescingMailbox<NetworkData>* m_networkMailbox;
+    CoalescingMailbox<StorageData>* m_storageMailbox;
+    CoalescingMailbox<SystemData>* m_systemLoadMailbox;
+    CoalescingMailbox<ProcessListData>* m_processMailbox;
+    CoalescingMailbox<quint64>* m_batchMailbox;
+    CoalescingMailbox<CPUData>* m_cpuAlertMailbox;
+    CoalescingMailbox<MemoryData>* m_memoryAlertMailbox;
 
     // Data synchronization
     SystemOverview m_currentOverview;
     mutable QMutex m_dataMutex;
-    QTimer* m_aggregationTimer;
+    QThread* m_collectorThread;
 
     // State
     bool m_isInitialized;
     bool m_isRunning;
     bool m_isPaused;
+    bool m_demandDriven;
     int m_updateInterval;
 };
 
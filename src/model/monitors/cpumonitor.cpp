@@ -7,25 +7,83 @@
 
 #include "cpumonitor.h"
 #include "core/systemutils.h"
+#include "core/systeminfocache.h"
 #include "core/constants.h"
-#include <QStringList>
+#include "core/sampleclock.h"
 #include <QDebug>
+#include <utility>
 
-CPUMonitor::CPUMonitor(QObject *parent) : BaseMonitor(parent), m_maxHistorySize(MAX_HISTORY_SIZE)
+namespace {
+
+// Delta math for the aggregate line. Fills the per-category split and
+// returns the busy percentage; per-core work goes through CPUKernels.
+double computeBreakdown(const CPUStat& current, const CPUStat& previous,
+                        CPUTimeBreakdown& breakdown)
 {
-    int coreCount = SystemUtils::getCPUCoreCount();
-    m_currentData.coreCount = coreCount;
-    m_currentData.cores.resize(coreCount);
-    m_coreStats.resize(coreCount);
-    m_previousCoreStats.resize(coreCount);
+    const qint64 user = qMax<qint64>(0, current.user - previous.user);
+    const qint64 nice = qMax<qint64>(0, current.nice - previous.nice);
+    const qint64 system = qMax<qint64>(0, current.system - previous.system);
+    const qint64 idle = qMax<qint64>(0, current.idle - previous.idle);
+    const qint64 iowait = qMax<qint64>(0, current.iowait - previous.iowait);
+    const qint64 irq = qMax<qint64>(0, current.irq - previous.irq);
+    const qint64 softirq = qMax<qint64>(0, current.softirq - previous.softirq);
+    const qint64 steal = qMax<qint64>(0, current.steal - previous.steal);
+
+    const qint64 totalDiff = user + nice + system + idle + iowait + irq + softirq + steal;
+    if (totalDiff <= 0) {
+        breakdown = CPUTimeBreakdown();
+        return 0.0;
+    }
+
+    const double scale = 100.0 / totalDiff;
+    breakdown.user = user * scale;
+    breakdown.nice = nice * scale;
+    breakdown.system = system * scale;
+    breakdown.idle = idle * scale;
+    breakdown.iowait = iowait * scale;
+    breakdown.irq = irq * scale;
+    breakdown.softirq = softirq * scale;
+    breakdown.steal = steal * scale;
+
+    return qBound(0.0, 100.0 - breakdown.idle, 100.0);
+}
+
+} // namespace
+
+CPUMonitor::CPUMonitor(QObject *parent)
+    : BaseMonitor(parent)
+    , m_maxHistorySize(MAX_HISTORY_SIZE)
+    , m_statSampleNs(0)
+    , m_statIntervalNs(0)
+    , m_statFresh(false)
+    , m_statReader(PROC_STAT, 16384)
+    , m_thermal(std::make_shared<SensorSource<ThermalSampler>>())
+    , m_frequency(std::make_shared<SensorSource<CPUFrequencySampler>>())
+    , m_thermalSource(-1)
+    , m_frequencySource(-1)
+    , m_frequencyDiscoverPending(false)
+    , m_systemInfoGeneration(0)
+{
+    // Static facts come from SystemInfoCache, no /proc/cpuinfo scan here
+    SystemInfoCache::checkHotplug();
+    m_systemInfoGeneration = SystemInfoCache::generation();
+    resizeCores(SystemUtils::getCPUCoreCount());
+    m_thermal->sampler.discover();
+    m_thermal->rebuild();
+    m_frequency->sampler.discover(m_currentData.coreCount);
+    m_frequency->rebuild();
+    m_frequencyDiscoverPending = false;
+    m_statReader.open();
+    addSensorSources();
 
     m_currentData.model = SystemUtils::getCPUModel();
+    m_snapshot.publish(m_currentData);
 }
 
 CPUData CPUMonitor::getCurrentData() const
 {
-    QMutexLocker locker(&m_dataMutex);
-    return m_currentData;
+    // Never waits for the collector, which holds m_dataMutex for a whole tick
+    return m_snapshot.read();
 }
 
 QVector<CPUData> CPUMonitor::getHistory() const
@@ -39,14 +97,46 @@ void CPUMonitor::setHistorySize(int size)
     m_maxHistorySize = qBound(10, size, 1000);
 }
 
+void CPUMonitor::setStatPath(const QString &path)
+{
+    QMutexLocker locker(&m_dataMutex);
+    m_statReader.setFilePath(path);
+    m_currentStats = CPUStat();
+    m_previousStats = CPUStat();
+    m_statCounters = ProcStatCounters();
+    m_previousStatCounters = ProcStatCounters();
+    m_statSampleNs = 0;
+    m_statIntervalNs = 0;
+}
+
 void CPUMonitor::collectData()
 {
-    // Save previous state for delta calculation
-    m_previousStats = m_currentStats;
-    m_previousCoreStats = m_coreStats;
-    m_previousData = m_currentData;
+    checkHotplug();
 
-    collectCPUStats();
+    // cpufreq files are re-opened only while its worker is idle
+    if (m_frequencyDiscoverPending && !m_sourceWatchdog.isInFlight(m_frequencySource)) {
+        m_frequency->sampler.discover(m_currentData.coreCount);
+        m_frequency->rebuild();
+        m_frequencyDiscoverPending = false;
+    }
+
+    // Sensors run on their workers while /proc/stat is read here; the
+    // stamp is taken right after the counters
+    m_sourceWatchdog.collect();
+    m_statFresh = m_statReader.read() > 0;
+    m_currentData.timestampNs = SampleClock::nowNs();
+
+    // No counters this tick: keep the last usage figures, the next read
+    // is compared to the last good one
+    if (m_statFresh) {
+        // Save previous state for delta calculation. Swapping keeps both
+        // core buffers unshared, so the parser writes in place.
+        m_previousStats = m_currentStats;
+        std::swap(m_previousCoreStats, m_coreStats);
+        m_previousStatCounters = m_statCounters;
+
+        collectCPUStats();
+    }
     collectTemperature();
     collectFrequency();
     collectCoreData();
@@ -54,9 +144,11 @@ void CPUMonitor::collectData()
 
 void CPUMonitor::processData()
 {
-    m_currentData.totalUsage = calculateUsagePercent();
+    if (m_statFresh) {
+        m_currentData.totalUsage = calculateUsagePercent();
+        calculateSchedulerRates();
+    }
     m_currentData.status = determineStatus();
-    m_currentData.timestamp = QDateTime::currentDateTime();
 }
 
 void CPUMonitor::validateData()
@@ -69,6 +161,10 @@ void CPUMonitor::validateData()
         m_currentData.temperature = 0.0;
     }
 
+    if (!SystemUtils::isValidTemperature(m_currentData.maxTemperature)) {
+        m_currentData.maxTemperature = 0.0;
+    }
+
     for (auto& core : m_currentData.cores) {
         if (!SystemUtils::isValidPercentage(core.usage)) {
             core.usage = 0.0;
@@ -78,14 +174,15 @@ void CPUMonitor::validateData()
 
 void CPUMonitor::emitSignal()
 {
+    m_snapshot.publish(m_currentData);
     emit cpuDataUpdated(m_currentData);
 
-    // Emit threshold warnings
-    if (m_currentData.temperature >= TEMP_CRITICAL_THRESHOLD) {
-        emit temperatureCritical(m_currentData.temperature);
+    // Emit threshold warnings (hottest CPU sensor)
+    if (m_currentData.maxTemperature >= TEMP_CRITICAL_THRESHOLD) {
+        emit temperatureCritical(m_currentData.maxTemperature);
     }
-    else if (m_currentData.temperature >= TEMP_WARNING_THRESHOLD) {
-        emit temperatureWarning(m_currentData.temperature);
+    else if (m_currentData.maxTemperature >= TEMP_WARNING_THRESHOLD) {
+        emit temperatureWarning(m_currentData.maxTemperature);
     }
 
     if (m_currentData.totalUsage >= CPU_CRITICAL_THRESHOLD) {
@@ -102,102 +199,183 @@ void CPUMonitor::emitSignal()
     }
 }
 
-void CPUMonitor::collectCPUStats()
+bool CPUMonitor::adaptiveMetric(double *value, double *threshold) const
 {
-    QString statContent = SystemUtils::readFile(PROC_STAT);
-    if (statContent.isEmpty()) return;
-
-    QStringList lines = statContent.split('\n', Qt::SkipEmptyParts);
-    if (lines.isEmpty()) return;
-
-    // Parse overall CPU line: "cpu, user, nice, system, idle..."
-    QString cpuLine = lines[0];
-    QStringList parts = cpuLine.split(' ', Qt::SkipEmptyParts);
-
-    if (parts.size() >= 8 && parts[0] == "cpu") {
-        m_currentStats.user = parts[1].toLongLong();
-        m_currentStats.nice = parts[2].toLongLong();
-        m_currentStats.system = parts[3].toLongLong();
-        m_currentStats.idle = parts[4].toLongLong();
-        m_currentStats.iowait = parts[5].toLongLong();
-        m_currentStats.irq = parts[6].toLongLong();
-        m_currentStats.softirq = parts[7].toLongLong();
-        m_currentStats.steal = (parts.size() > 8) ? parts[8].toLongLong() : 0;
-    }
-
-    // Parse per-core stats: "cpu0", "cpu1", etc
-    for (int i = 0; i < m_currentData.coreCount && i + 1 < lines.size(); ++i) {
-        QString coreLine = lines[i + 1];
-        QStringList coreParts = coreLine.split(' ', Qt::SkipEmptyParts);
-
-        if (coreParts.size() >= 8 && coreParts[0] == QString("cpu%1").arg(i)) {
-            CPUStat& coreStat = m_coreStats[i];
-            coreStat.user = coreParts[1].toLongLong();
-            coreStat.nice = coreParts[2].toLongLong();
-            coreStat.system = coreParts[3].toLongLong();
-            coreStat.idle = coreParts[4].toLongLong();
-            coreStat.iowait = coreParts[5].toLongLong();
-            coreStat.irq = coreParts[6].toLongLong();
-            coreStat.softirq = coreParts[7].toLongLong();
-            coreStat.steal = (coreParts.size() > 8) ? coreParts[8].toLongLong() : 0;
-        }
-    }
+    if (!m_currentData.isValid()) return false;
+
+    *value = m_currentData.totalUsage;
+    *threshold = CPU_WARNING_THRESHOLD;
+    return true;
 }
 
-void CPUMonitor::collectTemperature()
+qint64 CPUMonitor::memoryFootprint() const
 {
-    m_currentData.temperature = SystemUtils::getCPUTemperature();
+    // Every history entry owns its own per-core vector (detached on write)
+    const qint64 coreBytes = static_cast<qint64>(m_currentData.coreCount) * sizeof(CPUCoreData);
+    qint64 bytes = m_history.capacity() * static_cast<qint64>(sizeof(CPUData));
+    bytes += (m_history.size() + 1) * coreBytes;
+
+    const qint64 coreColumns = static_cast<qint64>(m_coreStats.stride()) * sizeof(quint64);
+    bytes += 2 * coreColumns * CPUStatArrays::FieldCount;
+    bytes += static_cast<qint64>(m_coreDeltas.stride()) * sizeof(double) * (CPUDeltaArrays::USAGE + 1);
+    bytes += m_statReader.capacity();
+    return bytes;
 }
 
-void CPUMonitor::collectFrequency()
+void CPUMonitor::resizeCores(int coreCount)
 {
-    m_currentData.averageFrequency = SystemUtils::getCPUFrequency();
+    m_currentData.coreCount = coreCount;
+    m_currentData.cores.resize(coreCount);
+    m_coreStats.resize(coreCount);
+    m_previousCoreStats.resize(coreCount);
+    m_coreDeltas.resize(coreCount, m_coreStats.stride());
+    m_frequencyDiscoverPending = true;
 }
 
-void CPUMonitor::collectCoreData()
+void CPUMonitor::checkHotplug()
 {
-    // Calculate per-core usage
-    for (int i = 0; i < m_currentData.coreCount; ++i) {
-        CPUCoreData& coreData = m_currentData.cores[i];
-        coreData.coreID = i;
-        coreData.frequency = m_currentData.averageFrequency;
-        coreData.temperature = m_currentData.temperature;
+    SystemInfoCache::checkHotplug();
+    const quint64 generation = SystemInfoCache::generation();
+    if (generation == m_systemInfoGeneration) return;
+
+    // CPUs came or went: re-open cpufreq files, resize if the count changed
+    m_systemInfoGeneration = generation;
+    const int coreCount = SystemUtils::getCPUCoreCount();
+    if (coreCount != m_currentData.coreCount) {
+        resizeCores(coreCount);
+    }
+    m_frequencyDiscoverPending = true;
+}
+
+void CPUMonitor::addSensorSources()
+{
+    std::shared_ptr<SensorSource<ThermalSampler>> thermal = m_thermal;
+    m_thermalSource = m_sourceWatchdog.addSource("thermal", [thermal] { return thermal->read(); });
+
+    std::shared_ptr<SensorSource<CPUFrequencySampler>> frequency = m_frequency;
+    m_frequencySource = m_sourceWatchdog.addSource("cpufreq", [frequency] { return frequency->read(); });
+}
 
-        if (i < m_coreStats.size() && i < m_previousCoreStats.size()) {
-            const CPUStat& current = m_coreStats[i];
-            const CPUStat& previous = m_previousCoreStats[i];
+void CPUMonitor::collectCPUStats()
+{
+    // Rates use the real time between reads, not the nominal interval
+    m_statIntervalNs = (m_statSampleNs > 0) ? m_currentData.timestampNs - m_statSampleNs : 0;
+    m_statSampleNs = m_currentData.timestampNs;
 
-            qint64 totalDiff = current.total() - previous.total();
-            qint64 idleDiff = current.idle - previous.idle;
+    ProcParser::parseCPUStat(m_statReader.data(), m_statReader.size(),
+                             m_currentStats, m_coreStats, &m_statCounters);
+}
 
-            if (totalDiff > 0) {
-                double usage = (1.0 - static_cast<double>(idleDiff) / totalDiff) * 100.0;
-                coreData.usage = qBound(0.0, usage, 100.0);
-            }
+void CPUMonitor::collectTemperature()
+{
+    m_currentData.temperatureStatus = m_sourceWatchdog.status(m_thermalSource);
+    if (!m_sourceWatchdog.isFresh(m_thermalSource)) {
+        // Stale: no reading rather than an old one
+        m_currentData.temperature = 0.0;
+        m_currentData.maxTemperature = 0.0;
+        for (ThermalZoneData& zone : m_currentData.thermalZones) {
+            zone.temperature = 0.0;
+            zone.status = MetricStatus::Unknown;
         }
+        return;
     }
+
+    // Every thermal zone and hwmon input found at startup, just read
+    const ThermalSampler& sampler = m_thermal->sampler;
+    m_currentData.temperature = sampler.cpuTemperature();
+    m_currentData.maxTemperature = sampler.maxTemperature();
+    m_currentData.thermalZones = sampler.zones();
 }
 
-double CPUMonitor::calculateUsagePercent()
+void CPUMonitor::collectFrequency()
 {
-    qint64 totalDiff = m_currentStats.total() - m_previousStats.total();
-    qint64 idleDiff = m_currentStats.idle - m_previousStats.idle;
+    m_currentData.frequencyStatus = m_sourceWatchdog.status(m_frequencySource);
 
-    if (totalDiff <= 0) {
-        return 0.0;
+    // scaling_cur_freq of all cores, just read by the worker
+    m_currentData.averageFrequency = m_sourceWatchdog.isFresh(m_frequencySource)
+        ? m_frequency->sampler.averageFrequency() : 0.0;
+}
+
+void CPUMonitor::collectCoreData()
+{
+    // Per-core delta math runs as one vector kernel over the SoA columns;
+    // without a fresh read the last deltas stand
+    if (m_statFresh) {
+        CPUKernels::computeCoreDeltas(m_coreStats, m_previousCoreStats, m_coreDeltas);
+    }
+
+    const int count = qMin(m_currentData.coreCount, m_coreDeltas.count());
+    const double* usage = m_coreDeltas.usage();
+    const double* user = m_coreDeltas.percent(CPUStatArrays::User);
+    const double* nice = m_coreDeltas.percent(CPUStatArrays::Nice);
+    const double* system = m_coreDeltas.percent(CPUStatArrays::System);
+    const double* idle = m_coreDeltas.percent(CPUStatArrays::Idle);
+    const double* iowait = m_coreDeltas.percent(CPUStatArrays::IOWait);
+    const double* irq = m_coreDeltas.percent(CPUStatArrays::IRQ);
+    const double* softirq = m_coreDeltas.percent(CPUStatArrays::SoftIRQ);
+    const double* steal = m_coreDeltas.percent(CPUStatArrays::Steal);
+    // Empty while cpufreq is not fresh: cores report 0 MHz
+    static const QVector<double> noFrequencies;
+    const QVector<double>& frequencies = m_sourceWatchdog.isFresh(m_frequencySource)
+        ? m_frequency->sampler.frequencies() : noFrequencies;
+    // Per-core coretemp inputs; the package value (0 while stale) otherwise
+    static const QVector<double> noTemperatures;
+    const QVector<double>& temperatures = m_sourceWatchdog.isFresh(m_thermalSource)
+        ? m_thermal->sampler.coreTemperatures() : noTemperatures;
+    CPUCoreData* cores = m_currentData.cores.data();
+
+    for (int i = 0; i < count; ++i) {
+        CPUCoreData& coreData = cores[i];
+        coreData.coreID = i;
+        coreData.frequency = (i < frequencies.size()) ? frequencies[i] : 0.0;
+        coreData.temperature = (i < temperatures.size()) ? temperatures[i] : m_currentData.temperature;
+        coreData.usage = usage[i];
+        coreData.breakdown.user = user[i];
+        coreData.breakdown.nice = nice[i];
+        coreData.breakdown.system = system[i];
+        coreData.breakdown.idle = idle[i];
+        coreData.breakdown.iowait = iowait[i];
+        coreData.breakdown.irq = irq[i];
+        coreData.breakdown.softirq = softirq[i];
+        coreData.breakdown.steal = steal[i];
     }
+}
+
+double CPUMonitor::calculateUsagePercent()
+{
+    return computeBreakdown(m_currentStats, m_previousStats, m_currentData.breakdown);
+}
 
-    double usage = (1.0 - static_cast<double>(idleDiff) / totalDiff) * 100.0;
-    return qBound(0.0, usage, 100.0);
+void CPUMonitor::calculateSchedulerRates()
+{
+    m_currentData.procsRunning = m_statCounters.procsRunning;
+    m_currentData.procsBlocked = m_statCounters.procsBlocked;
+
+    // First sample has no previous counters
+    if (m_statIntervalNs <= 0) return;
+
+    const double seconds = m_statIntervalNs / 1e9;
+    auto rate = [seconds](qint64 current, qint64 previous) {
+        return (current >= previous) ? (current - previous) / seconds : 0.0;
+    };
+
+    m_currentData.contextSwitchRate = rate(m_statCounters.contextSwitches,
+                                           m_previousStatCounters.contextSwitches);
+    m_currentData.interruptRate = rate(m_statCounters.interrupts,
+                                       m_previousStatCounters.interrupts);
+    m_currentData.softirqRate = rate(m_statCounters.softirqs,
+                                     m_previousStatCounters.softirqs);
+    m_currentData.forkRate = rate(m_statCounters.processesCreated,
+                                  m_previousStatCounters.processesCreated);
 }
 
 MetricStatus CPUMonitor::determineStatus() const
 {
-    // Temperature has priority
-    if (m_currentData.temperature >= TEMP_CRITICAL_THRESHOLD) {
+    // Temperature has priority, judged on the hottest CPU sensor
+    if (m_currentData.maxTemperature >= TEMP_CRITICAL_THRESHOLD) {
         return MetricStatus::Critical;
     }
-    if (m_currentData.temperature >= TEMP_WARNING_THRESHOLD) {
+    if (m_currentData.maxTemperature >= TEMP_WARNING_THRESHOLD) {
         return MetricStatus::Warning;
     }
 
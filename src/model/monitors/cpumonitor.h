@@ -3,6 +3,15 @@
 
 #include "model/base/basemonitor.h"
 #include "core/types.h"
+#include "core/procfilereader.h"
+#include "core/snapshotbuffer.h"
+#include "core/procparser.h"
+#include "core/cpukernels.h"
+#include "core/cpufrequencysampler.h"
+#include "core/thermalsampler.h"
+#include "core/procreadbatch.h"
+#include "core/sourcewatchdog.h"
+#include <memory>
 
 class CPUMonitor : public BaseMonitor
 {
@@ -10,11 +19,14 @@ class CPUMonitor : public BaseMonitor
 public:
     explicit CPUMonitor(QObject *parent = nullptr);
 
-    // Data access
+    // Data access (getCurrentData() is lock-free, callable from any thread)
     CPUData getCurrentData() const;
     QVector<CPUData> getHistory() const;
     void setHistorySize(int size);
 
+    // Read another file in /proc/stat format (tests)
+    void setStatPath(const QString& path);
+
 signals:
     void cpuDataUpdated(const CPUData& data);
     void temperatureWarning(double temp);
@@ -28,9 +40,14 @@ protected:
     void processData() override;
     void validateData() override;
     void emitSignal() override;
+    bool adaptiveMetric(double* value, double* threshold) const override;
+    qint64 memoryFootprint() const override;
 
 private:
     // Data collection
+    void resizeCores(int coreCount);
+    void checkHotplug();
+    void addSensorSources();
     void collectCPUStats();
     void collectTemperature();
     void collectFrequency();
@@ -38,34 +55,55 @@ private:
 
     // Calculations
     double calculateUsagePercent();
+    void calculateSchedulerRates();
     MetricStatus determineStatus() const;
 
-    // CPU statistics structure
-    struct CPUStat {
-        qint64 user, nice, system, idle, iowait, irq, softirq, steal;
-
-        qint64 total() const {
-            return user + nice + system + idle + iowait + irq + softirq + steal;
-        }
-
-        qint64 active() const {
-            return total() - idle- iowait;
-        }
-
-        CPUStat() : user(0), nice(0), system(0), idle(0), iowait(0), irq(0), softirq(0), steal(0) {}
-    };
-
     // Data members
     CPUData m_currentData;
-    CPUData m_previousData;
+    SnapshotBuffer<CPUData> m_snapshot;      // Published copy of m_currentData
     QVector<CPUData> m_history;
     int m_maxHistorySize;
 
     // Raw CPU stats for delta calculation
     CPUStat m_currentStats;
     CPUStat m_previousStats;
-    QVector<CPUStat> m_coreStats;
-    QVector<CPUStat> m_previousCoreStats;
+    CPUStatArrays m_coreStats;
+    CPUStatArrays m_previousCoreStats;
+    CPUDeltaArrays m_coreDeltas;
+
+    // /proc/stat tail counters and the real interval between reads
+    ProcStatCounters m_statCounters;
+    ProcStatCounters m_previousStatCounters;
+    qint64 m_statSampleNs;
+    qint64 m_statIntervalNs;
+    bool m_statFresh;                       // /proc/stat read this tick
+
+    /**
+     * @brief A sysfs sampler and its batch, read on a watchdog worker
+     * Shared with the worker, which may outlive the monitor while hung.
+     */
+    template <typename Sampler>
+    struct SensorSource {
+        Sampler sampler;
+        ProcReadBatch batch;
+
+        void rebuild() { batch.clear(); sampler.addReaders(batch); }
+        bool read() { batch.readAll(); sampler.update(); return true; }
+    };
+
+    // Persistent /proc reader, read inline (procfs counters do not block)
+    ProcFileReader m_statReader;
+
+    // sysfs files go through drivers that can wedge: deadline-bounded
+    std::shared_ptr<SensorSource<ThermalSampler>> m_thermal;
+    std::shared_ptr<SensorSource<CPUFrequencySampler>> m_frequency;
+    SourceWatchdog m_sourceWatchdog;
+    int m_thermalSource;
+    int m_frequencySource;
+    bool m_frequencyDiscoverPending;        // Hotplug seen while cpufreq was in flight
+
+    // SystemInfoCache generation the per-core buffers were sized for
+    quint64 m_systemInfoGeneration;
 };
 
 #endif // CPUMONITOR_H
@@ -5,21 +5,25 @@
 
 #include "memorymonitor.h"
 #include "core/systemutils.h"
+#include "core/procparser.h"
 #include "core/constants.h"
+#include "core/sampleclock.h"
 #include <QDebug>
-#include <QRegularExpression>
-#include <QRegularExpressionMatch>
 
-MemoryMonitor::MemoryMonitor(QObject *parent) : BaseMonitor(parent), m_maxHistorySize(MAX_HISTORY_SIZE)
+MemoryMonitor::MemoryMonitor(QObject *parent)
+    : BaseMonitor(parent)
+    , m_maxHistorySize(MAX_HISTORY_SIZE)
+    , m_meminfoReader(PROC_MEMINFO, 8192)
 {
     // Initialize with basic memry info
     m_currentData.totalRAM = SystemUtils::getTotalMemory();
+    m_snapshot.publish(m_currentData);
 }
 
 MemoryData MemoryMonitor::getCurrentData() const
 {
-    QMutexLocker locker(&m_dataMutex);
-    return m_currentData;
+    // Never waits for the collector, which holds m_dataMutex for a whole tick
+    return m_snapshot.read();
 }
 
 QVector<MemoryData> MemoryMonitor::getHistory() const
@@ -44,7 +48,8 @@ double MemoryMonitor::getMemoryEfficiency() const
 qint64 MemoryMonitor::getMemoryPressure() const
 {
     QMutexLocker locker(&m_dataMutex);
-    return m_currentData.usedRAM - m_currentData.buffers - m_currentData.cached;
+    // usedRAM already excludes reclaimable buffers and cache
+    return m_currentData.usedRAM;
 }
 
 bool MemoryMonitor::isSwapping() const
@@ -56,7 +61,6 @@ bool MemoryMonitor::isSwapping() const
 void MemoryMonitor::collectData()
 {
     collectMemoryInfo();
-    collectSwapInfo();
 }
 
 void MemoryMonitor::processData()
@@ -64,7 +68,6 @@ void MemoryMonitor::processData()
     m_currentData.usagePercentage = calculateUsagePercent();
     m_currentData.swapPercentage = calculateSwapPercent();
     m_currentData.status = determineStatus();
-    m_currentData.timestamp = QDateTime::currentDateTime();
 }
 
 void MemoryMonitor::validateData()
@@ -85,6 +88,7 @@ void MemoryMonitor::validateData()
 
 void MemoryMonitor::emitSignal()
 {
+    m_snapshot.publish(m_currentData);
     emit memoryDataUpdated(m_currentData);
 
     // Emit threshold warnings
@@ -111,34 +115,28 @@ void MemoryMonitor::emitSignal()
     }
 }
 
-void MemoryMonitor::collectMemoryInfo()
+bool MemoryMonitor::adaptiveMetric(double *value, double *threshold) const
 {
-    m_currentData.totalRAM = SystemUtils::getTotalMemory();
-    m_currentData.freeRAM = SystemUtils::getFreeMemory();
-    m_currentData.availableRAM = SystemUtils::getAvailableMemory();
-    m_currentData.buffers = SystemUtils::getBufferMemory();
-    m_currentData.cached = SystemUtils::getCacheMemory();
+    if (!m_currentData.isValid()) return false;
+
+    *value = m_currentData.usagePercentage;
+    *threshold = RAM_WARNING_THRESHOLD;
+    return true;
 }
 
-void MemoryMonitor::collectSwapInfo()
+qint64 MemoryMonitor::memoryFootprint() const
 {
-    // Read swap info from /proc/meminfo
-    QString swapTotalStr = SystemUtils::extractValueFromProcFile(PROC_MEMINFO, "SwapTotal");
-    QString swapFreeStr = SystemUtils::extractValueFromProcFile(PROC_MEMINFO, "SwapFree");
-
-    // Parse swap values (format: "123456 kB")
-    QRegularExpression regex("(\\d+)\\s*kB");
+    return m_history.capacity() * static_cast<qint64>(sizeof(MemoryData)) +
+           m_meminfoReader.capacity();
+}
 
-    QRegularExpressionMatch totalMatch = regex.match(swapTotalStr);
-    if (totalMatch.hasMatch()) {
-        m_currentData.swapTotal = totalMatch.captured(1).toLongLong() * 1024;
-    }
+void MemoryMonitor::collectMemoryInfo()
+{
+    // One read, one scan: RAM, swap and the extra keys together
+    if (m_meminfoReader.read() <= 0) return;
+    m_currentData.timestampNs = SampleClock::nowNs();
 
-    QRegularExpressionMatch freeMatch = regex.match(swapFreeStr);
-    if (freeMatch.hasMatch()) {
-        qint64 swapFree = freeMatch.captured(1).toLongLong() * 1024;
-        m_currentData.swapUsed = m_currentData.swapTotal - swapFree;
-    }
+    ProcParser::parseMemInfo(m_meminfoReader.data(), m_meminfoReader.size(), m_currentData);
 }
 
 double MemoryMonitor::calculateUsagePercent() const
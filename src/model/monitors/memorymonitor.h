@@ -10,6 +10,8 @@
 
 #include "model/base/basemonitor.h"
 #include "core/types.h"
+#include "core/procfilereader.h"
+#include "core/snapshotbuffer.h"
 #include <QVector>
 
 class MemoryMonitor : public BaseMonitor
@@ -18,14 +20,14 @@ class MemoryMonitor : public BaseMonitor
 public:
     explicit MemoryMonitor(QObject *parent = nullptr);
 
-    // Data access
+    // Data access (getCurrentData() is lock-free, callable from any thread)
     MemoryData getCurrentData() const;
     QVector<MemoryData> getHistory() const;
     void setHistorySize(int size);
 
     // Memory analysis
     double getMemoryEfficiency() const;    // Available/Total * 100
-    qint64 getMemoryPressure() const;      // Used - Buffers - Cache
+    qint64 getMemoryPressure() const;      // Total - Available (non-reclaimable)
     bool isSwapping() const;               // Swap usage > 0
 
 signals:
@@ -41,11 +43,12 @@ protected:
     void processData() override;
     void validateData() override;
     void emitSignal() override;
+    bool adaptiveMetric(double* value, double* threshold) const override;
+    qint64 memoryFootprint() const override;
 
 private:
     // Data collection
     void collectMemoryInfo();
-    void collectSwapInfo();
 
     // Calculations
     double calculateUsagePercent() const;
@@ -54,9 +57,13 @@ private:
 
     // Data members
     MemoryData m_currentData;
+    SnapshotBuffer<MemoryData> m_snapshot;      // Published copy of m_currentData
     QVector<MemoryData> m_history;
     int m_maxHistorySize;
 
+    // Persistent /proc/meminfo reader, one read per tick
+    ProcFileReader m_meminfoReader;
+
     // Low memory threshold for Pi 3B+ (50MB)
     static const qint64 LOW_MEMORY_THRESHOLD = 50 * 1024 * 1024;
 };
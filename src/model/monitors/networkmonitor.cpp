@@ -0,0 +1,279 @@
+/**
+ * @file networkmonitor.cpp
+ * @brief Network interface monitoring implementation
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#include "networkmonitor.h"
+#include "core/constants.h"
+#include "core/sampleclock.h"
+#include "core/systeminfocache.h"
+#include <QDebug>
+#include <QLatin1String>
+#include <QtMath>
+#include <utility>
+
+namespace {
+
+inline bool isLoopback(const NetDevStat& stat)
+{
+    return stat.nameLength == 2 && stat.name[0] == 'l' && stat.name[1] == 'o';
+}
+
+} // namespace
+
+NetworkMonitor::NetworkMonitor(QObject *parent)
+    : BaseMonitor(parent)
+    , m_maxHistorySize(MAX_HISTORY_SIZE)
+    , m_previousIndexValid(false)
+    , m_wideCounters(SystemInfoCache::is64BitKernel())
+    , m_sampleNs(0)
+    , m_intervalNs(0)
+    , m_netDevReader(PROC_NET_DEV, 16384)
+{
+    setUpdateInterval(NETWORK_UPDATE_INTERVAL);
+    m_snapshot.publish(m_currentData);
+}
+
+NetworkData NetworkMonitor::getCurrentData() const
+{
+    // Never waits for the collector, which holds m_dataMutex for a whole tick
+    return m_snapshot.read();
+}
+
+QVector<NetworkData> NetworkMonitor::getHistory() const
+{
+    QMutexLocker locker(&m_dataMutex);
+    return m_history;
+}
+
+void NetworkMonitor::setHistorySize(int size)
+{
+    m_maxHistorySize = qBound(10, size, 1000);
+}
+
+void NetworkMonitor::setWideCounters(bool wide)
+{
+    QMutexLocker locker(&m_dataMutex);
+    m_wideCounters = wide;
+}
+
+void NetworkMonitor::setNetDevPath(const QString &path)
+{
+    QMutexLocker locker(&m_dataMutex);
+    m_netDevReader.setFilePath(path);
+    m_stats.clear();
+    m_previousStats.clear();
+    m_previousIndexValid = false;
+    m_sampleNs = 0;
+    m_intervalNs = 0;
+}
+
+void NetworkMonitor::collectData()
+{
+    // No counters this tick: no rates, the next read spans both intervals
+    if (m_netDevReader.read() <= 0) {
+        m_intervalNs = 0;
+        return;
+    }
+    const qint64 nowNs = SampleClock::nowNs();
+
+    // Swapping keeps both vectors' capacity, the parser writes in place
+    std::swap(m_previousStats, m_stats);
+    m_previousIndexValid = false;
+    ProcParser::parseNetDev(m_netDevReader.data(), m_netDevReader.size(), m_stats);
+
+    // Rates use the real time between reads, not the nominal interval
+    m_intervalNs = (m_sampleNs > 0) ? nowNs - m_sampleNs : 0;
+    m_sampleNs = nowNs;
+    m_currentData.timestampNs = nowNs;
+}
+
+void NetworkMonitor::processData()
+{
+    const double perSecond = (m_intervalNs > 0) ? 1e9 / m_intervalNs : 0.0;
+    const int count = static_cast<int>(m_stats.size());
+
+    // Entries are reused slot by slot; names are only rebuilt on churn
+    m_currentData.interfaces.resize(count);
+    NetworkInterfaceData* interfaces = m_currentData.interfaces.data();
+
+    double download = 0.0;
+    double upload = 0.0;
+    double errors = 0.0;
+    double drops = 0.0;
+    int busiest = -1;
+    int fallback = -1;
+    double busiestRate = 0.0;
+    bool activeStillPresent = false;
+
+    for (int i = 0; i < count; ++i) {
+        const NetDevStat& stat = m_stats[static_cast<size_t>(i)];
+
+        NetworkInterfaceData& data = interfaces[i];
+        updateInterface(data, stat, findPrevious(i), perSecond);
+        if (isLoopback(stat)) continue;
+
+        download += data.downloadSpeed;
+        upload += data.uploadSpeed;
+        errors += data.receiveErrorRate + data.sendErrorRate;
+        drops += data.receiveDropRate + data.sendDropRate;
+
+        const double rate = data.downloadSpeed + data.uploadSpeed;
+        if (rate > busiestRate) {
+            busiestRate = rate;
+            busiest = i;
+        }
+        if (fallback < 0) fallback = i;
+        if (!activeStillPresent && data.name == m_currentData.activeInterface) {
+            activeStillPresent = true;
+        }
+    }
+
+    m_currentData.totalDownloadSpeed = download;
+    m_currentData.totalUploadSpeed = upload;
+    m_currentData.totalErrorRate = errors;
+    m_currentData.totalDropRate = drops;
+
+    // Busiest interface; while idle, keep the current one if it still exists
+    if (busiest >= 0) {
+        m_currentData.activeInterface = interfaces[busiest].name;
+    } else if (!activeStillPresent) {
+        m_currentData.activeInterface = (fallback >= 0) ? interfaces[fallback].name : QString();
+    }
+
+    m_currentData.status = determineStatus();
+}
+
+void NetworkMonitor::validateData()
+{
+    double* totals[] = {
+        &m_currentData.totalDownloadSpeed, &m_currentData.totalUploadSpeed,
+        &m_currentData.totalErrorRate, &m_currentData.totalDropRate
+    };
+    for (double* total : totals) {
+        if (!qIsFinite(*total) || *total < 0.0) {
+            *total = 0.0;
+        }
+    }
+}
+
+void NetworkMonitor::emitSignal()
+{
+    m_snapshot.publish(m_currentData);
+    emit networkDataUpdated(m_currentData);
+
+    const double peak = qMax(m_currentData.totalDownloadSpeed, m_currentData.totalUploadSpeed);
+    if (peak >= NETWORK_WARNING_THRESHOLD * 1024.0 * 1024.0) {
+        emit throughputWarning(peak);
+    }
+
+    // History keeps the totals: thousands of interfaces per entry would
+    // dwarf every other monitor's memory
+    NetworkData entry = m_currentData;
+    entry.interfaces.clear();
+    m_history.append(entry);
+    if (m_history.size() > m_maxHistorySize) {
+        m_history.removeFirst();
+    }
+}
+
+qint64 NetworkMonitor::memoryFootprint() const
+{
+    qint64 bytes = static_cast<qint64>(m_stats.capacity() + m_previousStats.capacity()) * sizeof(NetDevStat);
+    bytes += m_currentData.interfaces.capacity() * static_cast<qint64>(sizeof(NetworkInterfaceData));
+    bytes += m_previousIndex.capacity() * static_cast<qint64>(sizeof(QByteArray) + sizeof(int));
+    bytes += m_history.capacity() * static_cast<qint64>(sizeof(NetworkData));
+    bytes += m_netDevReader.capacity();
+    return bytes;
+}
+
+// ===================================================================
+// CALCULATIONS
+// ===================================================================
+
+const NetDevStat* NetworkMonitor::findPrevious(int index)
+{
+    const NetDevStat& stat = m_stats[static_cast<size_t>(index)];
+
+    // Same slot as last time: the common case, no lookup
+    if (static_cast<size_t>(index) < m_previousStats.size() &&
+        m_previousStats[static_cast<size_t>(index)].sameName(stat)) {
+        return &m_previousStats[static_cast<size_t>(index)];
+    }
+
+    // Interfaces came or went: index the previous sample once per tick
+    if (!m_previousIndexValid) {
+        m_previousIndex.clear();
+        m_previousIndex.reserve(static_cast<int>(m_previousStats.size()));
+        for (size_t i = 0; i < m_previousStats.size(); ++i) {
+            const NetDevStat& previous = m_previousStats[i];
+            m_previousIndex.insert(QByteArray(previous.name, previous.nameLength), static_cast<int>(i));
+        }
+        m_previousIndexValid = true;
+    }
+
+    QHash<QByteArray, int>::const_iterator it =
+        m_previousIndex.constFind(QByteArray::fromRawData(stat.name, stat.nameLength));
+    return (it != m_previousIndex.constEnd()) ? &m_previousStats[static_cast<size_t>(*it)] : nullptr;
+}
+
+void NetworkMonitor::updateInterface(NetworkInterfaceData &data, const NetDevStat &stat,
+                                     const NetDevStat *previous, double perSecond)
+{
+    const QLatin1String name(stat.name, stat.nameLength);
+    if (data.name != name) {
+        data.name = name;
+    }
+
+    const quint64* counters = stat.counters;
+    data.bytesReceived = static_cast<qint64>(counters[NetDevStat::RxBytes]);
+    data.bytesSent = static_cast<qint64>(counters[NetDevStat::TxBytes]);
+    data.packetsReceived = static_cast<qint64>(counters[NetDevStat::RxPackets]);
+    data.packetsSent = static_cast<qint64>(counters[NetDevStat::TxPackets]);
+    data.receiveErrors = static_cast<qint64>(counters[NetDevStat::RxErrors]);
+    data.sendErrors = static_cast<qint64>(counters[NetDevStat::TxErrors]);
+    data.receiveDrops = static_cast<qint64>(counters[NetDevStat::RxDrops]);
+    data.sendDrops = static_cast<qint64>(counters[NetDevStat::TxDrops]);
+    data.timestampNs = m_currentData.timestampNs;
+
+    // New interface or first sample: no rates yet
+    if (!previous || perSecond <= 0.0) {
+        data.downloadSpeed = data.uploadSpeed = 0.0;
+        data.packetReceiveRate = data.packetSendRate = 0.0;
+        data.receiveErrorRate = data.sendErrorRate = 0.0;
+        data.receiveDropRate = data.sendDropRate = 0.0;
+        data.isActive = false;
+        return;
+    }
+
+    const quint64* before = previous->counters;
+    auto rate = [&](int counter) {
+        return ProcParser::counterDelta(before[counter], counters[counter], m_wideCounters) * perSecond;
+    };
+
+    data.downloadSpeed = rate(NetDevStat::RxBytes);
+    data.uploadSpeed = rate(NetDevStat::TxBytes);
+    data.packetReceiveRate = rate(NetDevStat::RxPackets);
+    data.packetSendRate = rate(NetDevStat::TxPackets);
+    data.receiveErrorRate = rate(NetDevStat::RxErrors);
+    data.sendErrorRate = rate(NetDevStat::TxErrors);
+    data.receiveDropRate = rate(NetDevStat::RxDrops);
+    data.sendDropRate = rate(NetDevStat::TxDrops);
+    data.isActive = data.packetReceiveRate > 0.0 || data.packetSendRate > 0.0;
+}
+
+MetricStatus NetworkMonitor::determineStatus() const
+{
+    if (m_stats.empty()) {
+        return MetricStatus::Unknown;
+    }
+
+    const double peak = qMax(m_currentData.totalDownloadSpeed, m_currentData.totalUploadSpeed);
+    if (peak >= NETWORK_WARNING_THRESHOLD * 1024.0 * 1024.0) {
+        return MetricStatus::Warning;
+    }
+
+    return MetricStatus::Normal;
+}
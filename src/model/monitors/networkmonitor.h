@@ -0,0 +1,90 @@
+/**
+ * @file networkmonitor.h
+ * @brief Network interface monitoring from /proc/net/dev
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#ifndef NETWORKMONITOR_H
+#define NETWORKMONITOR_H
+
+#include "model/base/basemonitor.h"
+#include "core/types.h"
+#include "core/procfilereader.h"
+#include "core/procparser.h"
+#include "core/snapshotbuffer.h"
+#include <QHash>
+#include <QVector>
+#include <vector>
+
+/**
+ * @brief Per-interface throughput, packet, error and drop rates
+ *
+ * One read and one pass over /proc/net/dev per tick. Rates divide the
+ * counter deltas by the real monotonic time between reads, not the
+ * nominal interval. Interfaces are matched to the previous sample by
+ * position first (the kernel keeps its list order), by name after
+ * churn; a new interface reports rates from its second sample on.
+ *
+ * Drivers without ndo_get_stats64 report unsigned long counters, which
+ * wrap at 2^32 on 32-bit kernels (the Pi target). The counter width
+ * follows the kernel's word size: ProcParser::counterDelta() tells such
+ * a wrap from a reset (re-created interface, driver reload), which
+ * counts as no traffic.
+ */
+class NetworkMonitor : public BaseMonitor
+{
+    Q_OBJECT
+public:
+    explicit NetworkMonitor(QObject *parent = nullptr);
+
+    // Data access (getCurrentData() is lock-free, callable from any thread)
+    NetworkData getCurrentData() const;
+    QVector<NetworkData> getHistory() const;    // Totals only, no interface lists
+    void setHistorySize(int size);
+
+    // Counter width, SystemInfoCache::is64BitKernel() by default
+    void setWideCounters(bool wide);
+
+    // Read another file in /proc/net/dev format (tests, other namespaces)
+    void setNetDevPath(const QString& path);
+
+signals:
+    void networkDataUpdated(const NetworkData& data);
+    void throughputWarning(double bytesPerSecond);
+
+protected:
+    // Template Method implementation
+    void collectData() override;
+    void processData() override;
+    void validateData() override;
+    void emitSignal() override;
+    qint64 memoryFootprint() const override;
+
+private:
+    // Calculations
+    const NetDevStat* findPrevious(int index);
+    void updateInterface(NetworkInterfaceData& data, const NetDevStat& stat,
+                         const NetDevStat* previous, double perSecond);
+    MetricStatus determineStatus() const;
+
+    // Data members
+    NetworkData m_currentData;
+    SnapshotBuffer<NetworkData> m_snapshot;     // Published copy of m_currentData
+    QVector<NetworkData> m_history;
+    int m_maxHistorySize;
+
+    // Raw counters of this and the previous read, in file order
+    std::vector<NetDevStat> m_stats;
+    std::vector<NetDevStat> m_previousStats;
+    QHash<QByteArray, int> m_previousIndex;     // Name -> m_previousStats, built on churn
+    bool m_previousIndexValid;
+    bool m_wideCounters;            // Kernel unsigned long is 64 bits
+    qint64 m_sampleNs;
+    qint64 m_intervalNs;
+
+    // Persistent /proc/net/dev reader, one read per tick
+    ProcFileReader m_netDevReader;
+};
+
+#endif // NETWORKMONITOR_H
@@ -0,0 +1,552 @@
+/**
+ * @file processmonitor.cpp
+ * @brief Per-process CPU and memory monitoring implementation
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#include "processmonitor.h"
+#include "core/constants.h"
+#include "core/sampleclock.h"
+#include "core/systeminfocache.h"
+#include <QDebug>
+#include <QFile>
+#include <QLatin1String>
+#include <QtMath>
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <ctime>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace {
+
+// Record layout of getdents64(), glibc has no declaration for it
+struct LinuxDirent64 {
+    quint64 d_ino;
+    qint64 d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[1];
+};
+
+// "<pid>" directory entry, 0 for "self", "sys" and the other files
+qint32 pidFromName(const char* name)
+{
+    if (*name < '1' || *name > '9') return 0;
+
+    qint32 pid = 0;
+    std::from_chars_result result = std::from_chars(name, name + strlen(name), pid);
+    return (result.ec == std::errc() && *result.ptr == '\0') ? pid : 0;
+}
+
+} // namespace
+
+ProcessMonitor::ProcessMonitor(QObject *parent)
+    : BaseMonitor(parent)
+    , m_maxHistorySize(MAX_HISTORY_SIZE)
+    , m_topCount(PROCESS_TOP_COUNT)
+    , m_processes(1024)
+    , m_tick(0)
+    , m_threadCount(0)
+    , m_runningCount(0)
+    , m_totalCpuUsage(0.0)
+    , m_sampleNs(0)
+    , m_intervalNs(0)
+    , m_eventDriven(true)
+    , m_eventsUnavailable(false)
+    , m_eventsReceived(0)
+    , m_listenStartTicks(0)
+    , m_eventHorizonTicks(0)
+    , m_reconcileIntervalNs(PROCESS_RECONCILE_INTERVAL * 1000000LL)
+    , m_lastReconcileNs(0)
+    , m_clockTicks(sysconf(_SC_CLK_TCK))
+    , m_pageSize(sysconf(_SC_PAGESIZE))
+    , m_procPath(QFile::encodeName(PROC_PATH))
+    , m_procFd(-1)
+    , m_direntBuffer(32768)
+    , m_fileBuffer(1024)
+{
+    if (m_clockTicks <= 0) m_clockTicks = 100;
+    if (m_pageSize <= 0) m_pageSize = 4096;
+
+    setUpdateInterval(PROCESS_UPDATE_INTERVAL);
+    m_snapshot.publish(m_currentData);
+}
+
+ProcessMonitor::~ProcessMonitor()
+{
+    closeProcDirectory();
+}
+
+ProcessListData ProcessMonitor::getCurrentData() const
+{
+    // Never waits for the collector, which holds m_dataMutex for a whole tick
+    return m_snapshot.read();
+}
+
+QVector<ProcessListData> ProcessMonitor::getHistory() const
+{
+    QMutexLocker locker(&m_dataMutex);
+    return m_history;
+}
+
+void ProcessMonitor::setHistorySize(int size)
+{
+    m_maxHistorySize = qBound(10, size, 1000);
+}
+
+void ProcessMonitor::setTopCount(int count)
+{
+    QMutexLocker locker(&m_dataMutex);
+    m_topCount = qBound(1, count, 100);
+}
+
+int ProcessMonitor::topCount() const
+{
+    QMutexLocker locker(&m_dataMutex);
+    return m_topCount;
+}
+
+void ProcessMonitor::setEventDriven(bool enabled)
+{
+    QMutexLocker locker(&m_dataMutex);
+    m_eventDriven = enabled;
+    m_eventsUnavailable = false;
+    if (!enabled) {
+        m_eventListener.reset();
+    }
+}
+
+bool ProcessMonitor::isEventDriven() const
+{
+    QMutexLocker locker(&m_dataMutex);
+    return m_eventListener != nullptr;
+}
+
+void ProcessMonitor::setReconcileInterval(int intervalMs)
+{
+    QMutexLocker locker(&m_dataMutex);
+    m_reconcileIntervalNs = qMax(PROCESS_UPDATE_INTERVAL, intervalMs) * 1000000LL;
+}
+
+void ProcessMonitor::setProcPath(const QString &path)
+{
+    QMutexLocker locker(&m_dataMutex);
+    closeProcDirectory();
+
+    // Events name host PIDs, which mean nothing in another tree
+    m_eventDriven = false;
+    m_eventListener.reset();
+
+    m_procPath = QFile::encodeName(path);
+    m_processes.clear();
+    m_sampleNs = 0;
+    m_intervalNs = 0;
+}
+
+void ProcessMonitor::collectData()
+{
+    m_threadCount = 0;
+    m_runningCount = 0;
+    m_totalCpuUsage = 0.0;
+
+    if (m_procFd < 0 && !openProcDirectory()) {
+        // No /proc (or not yet mounted): nothing to report, retry next tick
+        m_processes.clear();
+        return;
+    }
+
+    const qint64 nowNs = SampleClock::nowNs();
+    m_intervalNs = (m_sampleNs > 0) ? nowNs - m_sampleNs : 0;
+    m_sampleNs = nowNs;
+    m_currentData.timestampNs = nowNs;
+
+    // Clock ticks -> percent of one core over the real interval
+    const double percentPerTick = (m_intervalNs > 0)
+        ? 100.0 * 1e9 / (static_cast<double>(m_intervalNs) * m_clockTicks) : 0.0;
+    ++m_tick;
+
+    if (m_eventDriven && !m_eventListener && !m_eventsUnavailable) {
+        startEventListener();
+    }
+    if (m_eventListener) {
+        applyEvents(percentPerTick);
+    }
+
+    // Without events every tick lists /proc. With them only the known
+    // PIDs are refreshed, and a periodic (or post-overflow) full listing
+    // picks up whatever the events missed
+    const bool reconcile = !m_eventListener || m_lastReconcileNs == 0 ||
+                           m_eventListener->takeOverflow() ||
+                           nowNs - m_lastReconcileNs >= m_reconcileIntervalNs;
+    bool complete = true;
+    if (reconcile) {
+        complete = scanProcDirectory(percentPerTick);
+        if (complete) m_lastReconcileNs = nowNs;
+    } else {
+        refreshKnownProcesses(percentPerTick);
+    }
+
+    // Processes not seen this tick have exited. A failed listing keeps
+    // them rather than dropping their CPU baselines
+    if (complete) {
+        const quint32 tick = m_tick;
+        m_processes.removeIf([tick](qint32, const ProcessSample& sample) {
+            return sample.seenTick != tick;
+        });
+    }
+}
+
+void ProcessMonitor::processData()
+{
+    selectTop([](const ProcessSample& sample) { return sample.cpuUsage; },
+              m_currentData.topByCpu);
+    selectTop([](const ProcessSample& sample) { return static_cast<double>(sample.residentPages); },
+              m_currentData.topByMemory);
+
+    m_currentData.processCount = m_processes.size();
+    m_currentData.threadCount = m_threadCount;
+    m_currentData.runningCount = m_runningCount;
+    m_currentData.totalCpuUsage = m_totalCpuUsage;
+    m_currentData.status = determineStatus();
+}
+
+void ProcessMonitor::validateData()
+{
+    if (!qIsFinite(m_currentData.totalCpuUsage) || m_currentData.totalCpuUsage < 0.0) {
+        m_currentData.totalCpuUsage = 0.0;
+    }
+
+    for (ProcessData& process : m_currentData.topByCpu) {
+        if (!qIsFinite(process.cpuUsage) || process.cpuUsage < 0.0) {
+            process.cpuUsage = 0.0;
+        }
+    }
+}
+
+void ProcessMonitor::emitSignal()
+{
+    m_snapshot.publish(m_currentData);
+    emit processDataUpdated(m_currentData);
+
+    // History keeps the totals, the lists are only meaningful right now
+    ProcessListData entry = m_currentData;
+    entry.topByCpu.clear();
+    entry.topByMemory.clear();
+    m_history.append(entry);
+    if (m_history.size() > m_maxHistorySize) {
+        m_history.removeFirst();
+    }
+}
+
+qint64 ProcessMonitor::memoryFootprint() const
+{
+    qint64 bytes = m_processes.memoryFootprint();
+    bytes += static_cast<qint64>(m_heap.capacity() * sizeof(Ranked));
+    bytes += static_cast<qint64>(m_direntBuffer.capacity() + m_fileBuffer.capacity());
+    bytes += static_cast<qint64>(m_events.capacity() * sizeof(ProcEvent));
+    bytes += (m_currentData.topByCpu.capacity() + m_currentData.topByMemory.capacity()) *
+             static_cast<qint64>(sizeof(ProcessData));
+    bytes += m_history.capacity() * static_cast<qint64>(sizeof(ProcessListData));
+    return bytes;
+}
+
+// ===================================================================
+// DATA COLLECTION
+// ===================================================================
+
+bool ProcessMonitor::openProcDirectory()
+{
+    m_procFd = ::open(m_procPath.constData(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    return m_procFd >= 0;
+}
+
+void ProcessMonitor::closeProcDirectory()
+{
+    if (m_procFd >= 0) {
+        ::close(m_procFd);
+        m_procFd = -1;
+    }
+}
+
+qint64 ProcessMonitor::readPidFile(qint32 pid, const char *file)
+{
+    // "<pid>/<file>" relative to the /proc descriptor
+    char path[64];
+    char* end = std::to_chars(path, path + 16, pid).ptr;
+    *end++ = '/';
+    strncpy(end, file, static_cast<size_t>(path + sizeof(path) - end));
+    path[sizeof(path) - 1] = '\0';
+
+    const int fd = ::openat(m_procFd, path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return -1;
+
+    ssize_t bytesRead;
+    do {
+        bytesRead = ::read(fd, m_fileBuffer.data(), m_fileBuffer.size() - 1);
+    } while (bytesRead < 0 && errno == EINTR);
+    ::close(fd);
+
+    if (bytesRead > 0) {
+        m_fileBuffer[static_cast<size_t>(bytesRead)] = '\0';
+    }
+    return bytesRead;
+}
+
+bool ProcessMonitor::scanProcDirectory(double percentPerTick)
+{
+    // A process that started while we listened, before the last drain,
+    // and still arrives unannounced means events do not reach this
+    // namespace at all; judged only while none ever arrived, since a
+    // single event proves delivery
+    const bool checkDelivery = m_eventListener && m_eventsReceived == 0 && m_lastReconcileNs > 0;
+    int unannounced = 0;
+
+    // Restart the listing; the descriptor itself is kept
+    if (::lseek(m_procFd, 0, SEEK_SET) != 0) {
+        return false;
+    }
+
+    for (;;) {
+        const long bytes = ::syscall(SYS_getdents64, m_procFd,
+                                     m_direntBuffer.data(), m_direntBuffer.size());
+        if (bytes == 0) break;
+        if (bytes < 0) return false;
+
+        for (long offset = 0; offset < bytes; ) {
+            const LinuxDirent64* entry =
+                reinterpret_cast<const LinuxDirent64*>(m_direntBuffer.data() + offset);
+            offset += entry->d_reclen;
+
+            if (entry->d_type != DT_DIR && entry->d_type != DT_UNKNOWN) continue;
+            const qint32 pid = pidFromName(entry->d_name);
+            if (pid <= 0) continue;
+
+            if (m_eventListener) {
+                // Sampled from an event earlier in this tick
+                const ProcessSample* known = m_processes.find(pid);
+                if (known && known->seenTick == m_tick) continue;
+            }
+
+            bool inserted = false;
+            const ProcessSample* sample = sampleProcess(pid, percentPerTick, &inserted);
+            if (checkDelivery && sample && inserted &&
+                sample->startTime > m_listenStartTicks + 1 &&
+                sample->startTime + 1 < m_eventHorizonTicks) {
+                ++unannounced;
+            }
+        }
+    }
+
+    if (unannounced > 0) {
+        qWarning() << "No process events for" << unannounced
+                   << "new processes (other namespace?) - polling /proc";
+        m_eventListener.reset();
+        m_eventsUnavailable = true;
+    }
+    return true;
+}
+
+void ProcessMonitor::refreshKnownProcesses(double percentPerTick)
+{
+    // One stat read per known PID, no directory listing
+    ProcPidStat stat;
+    m_processes.forEach([&](qint32 pid, ProcessSample& sample) {
+        if (sample.seenTick == m_tick) return;  // Sampled from an event
+        if (readProcessStat(pid, stat)) {
+            updateSample(sample, stat, false, percentPerTick);
+        }
+    });
+}
+
+bool ProcessMonitor::readProcessStat(qint32 pid, ProcPidStat &stat)
+{
+    // The process may have exited since it was listed
+    const qint64 size = readPidFile(pid, "stat");
+    return size > 0 && ProcParser::parsePidStat(m_fileBuffer.data(), size, stat);
+}
+
+ProcessMonitor::ProcessSample *ProcessMonitor::sampleProcess(qint32 pid, double percentPerTick, bool *inserted)
+{
+    ProcPidStat stat;
+    if (!readProcessStat(pid, stat)) return nullptr;
+
+    bool created = false;
+    ProcessSample& sample = m_processes.insert(pid, &created);
+    updateSample(sample, stat, created, percentPerTick);
+
+    if (inserted) *inserted = created;
+    return &sample;
+}
+
+void ProcessMonitor::updateSample(ProcessSample &sample, const ProcPidStat &stat,
+                                  bool created, double percentPerTick)
+{
+    const quint64 cpuTicks = stat.userTime + stat.systemTime;
+
+    // New PID, or one reused by another process since the last tick:
+    // no baseline yet
+    if (created || sample.startTime != stat.startTime || cpuTicks < sample.cpuTicks) {
+        sample.cpuUsage = 0.0;
+        sample.startTime = stat.startTime;
+    } else {
+        sample.cpuUsage = static_cast<double>(cpuTicks - sample.cpuTicks) * percentPerTick;
+    }
+
+    sample.cpuTicks = cpuTicks;
+    sample.virtualSize = stat.virtualSize;
+    sample.residentPages = stat.residentPages;
+    sample.parentPid = stat.parentPid;
+    sample.threadCount = stat.threadCount;
+    sample.seenTick = m_tick;
+    sample.state = stat.state;
+
+    // exec() and prctl() rename processes, copying 16 bytes beats comparing
+    memcpy(sample.comm, stat.comm, sizeof(sample.comm));
+    sample.commLength = static_cast<quint8>(stat.commLength);
+
+    m_threadCount += stat.threadCount;
+    m_totalCpuUsage += sample.cpuUsage;
+    if (stat.state == 'R') {
+        ++m_runningCount;
+    }
+}
+
+// ===================================================================
+// PROCESS EVENTS
+// ===================================================================
+
+void ProcessMonitor::startEventListener()
+{
+    std::unique_ptr<ProcEventListener> listener(new ProcEventListener());
+    if (!listener->start()) {
+        // Usually EPERM without CAP_NET_ADMIN
+        qWarning() << "Process events unavailable:" << strerror(listener->error()) << "- polling /proc";
+        m_eventsUnavailable = true;
+        return;
+    }
+
+    m_eventListener = std::move(listener);
+    m_eventsReceived = 0;
+    m_listenStartTicks = bootTicks();
+    m_lastReconcileNs = 0;      // Full listing on this tick
+}
+
+void ProcessMonitor::applyEvents(double percentPerTick)
+{
+    // Everything that started before this point had its fork queued
+    m_eventHorizonTicks = bootTicks();
+
+    m_events.clear();
+    m_eventListener->readEvents(m_events);
+    if (!m_eventListener->isActive()) {
+        qWarning() << "Process events refused:" << strerror(m_eventListener->error()) << "- polling /proc";
+        m_eventListener.reset();
+        m_eventsUnavailable = true;
+        return;
+    }
+    m_eventsReceived += m_events.size();
+
+    // Exits first: a PID that exited and was reused within the tick is
+    // then sampled as the new process
+    for (const ProcEvent& event : m_events) {
+        if (event.type == ProcEvent::Exit) {
+            m_processes.remove(event.pid);
+        }
+    }
+
+    for (const ProcEvent& event : m_events) {
+        if (event.type == ProcEvent::Exit) continue;
+
+        // Fork and exec of one process arrive together
+        const ProcessSample* known = m_processes.find(event.pid);
+        if (known && known->seenTick == m_tick) continue;
+        sampleProcess(event.pid, percentPerTick);
+    }
+}
+
+quint64 ProcessMonitor::bootTicks() const
+{
+    // Start times in /proc/<pid>/stat count from boot including suspend,
+    // which CLOCK_MONOTONIC does not
+    timespec now;
+    if (clock_gettime(CLOCK_BOOTTIME, &now) != 0) return 0;
+    return static_cast<quint64>(now.tv_sec) * static_cast<quint64>(m_clockTicks) +
+           static_cast<quint64>(now.tv_nsec) * static_cast<quint64>(m_clockTicks) / 1000000000ULL;
+}
+
+// ===================================================================
+// CALCULATIONS
+// ===================================================================
+
+template <typename Key>
+void ProcessMonitor::selectTop(Key key, QVector<ProcessData> &list)
+{
+    // Higher key first, lower PID on ties so the order is stable
+    auto better = [](const Ranked& a, const Ranked& b) {
+        return a.key > b.key || (a.key == b.key && a.pid < b.pid);
+    };
+
+    // Bounded heap of the best m_topCount, the weakest at the root
+    const size_t limit = static_cast<size_t>(m_topCount);
+    m_heap.clear();
+    m_processes.forEach([&](qint32 pid, const ProcessSample& sample) {
+        const Ranked candidate = { key(sample), pid, &sample };
+        if (candidate.key <= 0.0) return;
+
+        if (m_heap.size() < limit) {
+            m_heap.push_back(candidate);
+            std::push_heap(m_heap.begin(), m_heap.end(), better);
+        } else if (better(candidate, m_heap.front())) {
+            std::pop_heap(m_heap.begin(), m_heap.end(), better);
+            m_heap.back() = candidate;
+            std::push_heap(m_heap.begin(), m_heap.end(), better);
+        }
+    });
+    std::sort_heap(m_heap.begin(), m_heap.end(), better);
+
+    list.resize(static_cast<int>(m_heap.size()));
+    for (int i = 0; i < list.size(); ++i) {
+        fillProcessData(list[i], m_heap[static_cast<size_t>(i)]);
+    }
+}
+
+void ProcessMonitor::fillProcessData(ProcessData &data, const Ranked &ranked)
+{
+    const ProcessSample& sample = *ranked.sample;
+
+    const QLatin1String name(sample.comm, sample.commLength);
+    if (data.name != name) {
+        data.name = name;
+    }
+
+    data.pid = ranked.pid;
+    data.parentPid = sample.parentPid;
+    data.state = sample.state;
+    data.cpuUsage = sample.cpuUsage;
+    data.memoryRss = sample.residentPages * m_pageSize;
+    data.memoryVirtual = static_cast<qint64>(sample.virtualSize);
+    data.threadCount = sample.threadCount;
+    data.startTime = SystemInfoCache::bootTime().addMSecs(
+        static_cast<qint64>(sample.startTime * 1000 / static_cast<quint64>(m_clockTicks)));
+
+    // The shared part is only in statm, read for listed processes only
+    ProcPidStatm statm;
+    const qint64 size = readPidFile(ranked.pid, "statm");
+    data.memoryShared = (size > 0 && ProcParser::parsePidStatm(m_fileBuffer.data(), size, statm))
+        ? statm.shared * m_pageSize : 0;
+}
+
+MetricStatus ProcessMonitor::determineStatus() const
+{
+    if (m_processes.isEmpty()) {
+        return MetricStatus::Unknown;
+    }
+
+    return MetricStatus::Normal;
+}
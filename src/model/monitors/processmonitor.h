@@ -0,0 +1,173 @@
+/**
+ * @file processmonitor.h
+ * @brief Per-process CPU and memory monitoring with top-N lists
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#ifndef PROCESSMONITOR_H
+#define PROCESSMONITOR_H
+
+#include "model/base/basemonitor.h"
+#include "core/types.h"
+#include "core/pidmap.h"
+#include "core/proceventlistener.h"
+#include "core/procparser.h"
+#include "core/snapshotbuffer.h"
+#include <QByteArray>
+#include <QVector>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Scans /proc once per tick and reports the heaviest processes
+ *
+ * Scales to tens of thousands of PIDs on one core:
+ * - /proc stays open as one directory descriptor, listed with raw
+ *   getdents64() into a reused buffer, no per-entry allocation
+ * - /proc/<pid>/stat is read with openat() relative to that descriptor,
+ *   so the kernel never walks "/proc" again per file. It carries the
+ *   CPU times and the RSS; statm is only read for the few processes
+ *   that end up in a top list
+ * - per-PID state lives in a PidMap (open addressing, no allocation per
+ *   process), CPU usage is the tick delta of utime + stime
+ * - the top-K lists come from bounded min-heaps: O(n log K), no sort
+ *   of the whole table
+ *
+ * A PID whose start time changed was reused by a new process: its
+ * previous CPU times are discarded instead of producing a bogus delta.
+ * Command names are only turned into QStrings for the listed processes.
+ *
+ * Event-driven mode (default where permitted): a ProcEventListener
+ * drained at the start of each tick keeps the PID set current, so a
+ * tick refreshes the known PIDs and samples the forked and exec'd ones
+ * without listing /proc. A full listing still runs every
+ * PROCESS_RECONCILE_INTERVAL and after an event overflow, correcting
+ * anything the events missed. Without CAP_NET_ADMIN, or when no events
+ * arrive (another namespace), the monitor polls /proc every tick.
+ */
+class ProcessMonitor : public BaseMonitor
+{
+    Q_OBJECT
+public:
+    explicit ProcessMonitor(QObject *parent = nullptr);
+    ~ProcessMonitor() override;
+
+    // Data access (getCurrentData() is lock-free, callable from any thread)
+    ProcessListData getCurrentData() const;
+    QVector<ProcessListData> getHistory() const;    // Totals only, no top lists
+    void setHistorySize(int size);
+
+    // Configuration
+    void setTopCount(int count);        // Entries per top list, 1..100
+    int topCount() const;
+
+    // Netlink process events; falls back to polling when unavailable
+    void setEventDriven(bool enabled);
+    bool isEventDriven() const;         // Listener currently active
+    void setReconcileInterval(int intervalMs);
+
+    // Scan another directory in /proc layout (tests, other namespaces),
+    // switches process events off
+    void setProcPath(const QString& path);
+
+signals:
+    void processDataUpdated(const ProcessListData& data);
+
+protected:
+    // Template Method implementation
+    void collectData() override;
+    void processData() override;
+    void validateData() override;
+    void emitSignal() override;
+    qint64 memoryFootprint() const override;
+
+private:
+    // Tracked state of one process, kept between ticks
+    struct ProcessSample {
+        quint64 startTime;      // Clock ticks after boot, detects PID reuse
+        quint64 cpuTicks;       // utime + stime
+        quint64 virtualSize;
+        qint64 residentPages;
+        double cpuUsage;
+        qint32 parentPid;
+        int threadCount;
+        quint32 seenTick;       // Last scan that listed the PID
+        char state;
+        char comm[ProcPidStat::COMM_SIZE];
+        quint8 commLength;
+
+        ProcessSample() : startTime(0), cpuTicks(0), virtualSize(0), residentPages(0),
+            cpuUsage(0.0), parentPid(0), threadCount(0), seenTick(0), state('?'),
+            commLength(0) { comm[0] = '\0'; }
+    };
+
+    // Heap entry of a top list
+    struct Ranked {
+        double key;
+        qint32 pid;
+        const ProcessSample* sample;
+    };
+
+    // Data collection
+    bool openProcDirectory();
+    void closeProcDirectory();
+    bool scanProcDirectory(double percentPerTick);
+    void refreshKnownProcesses(double percentPerTick);
+    qint64 readPidFile(qint32 pid, const char* file);
+    bool readProcessStat(qint32 pid, ProcPidStat& stat);
+    ProcessSample* sampleProcess(qint32 pid, double percentPerTick, bool* inserted = nullptr);
+    void updateSample(ProcessSample& sample, const ProcPidStat& stat,
+                      bool created, double percentPerTick);
+
+    // Process events
+    void startEventListener();
+    void applyEvents(double percentPerTick);
+    quint64 bootTicks() const;          // CLOCK_BOOTTIME in clock ticks
+
+    // Calculations
+    template <typename Key>
+    void selectTop(Key key, QVector<ProcessData>& list);
+    void fillProcessData(ProcessData& data, const Ranked& ranked);
+    MetricStatus determineStatus() const;
+
+    // Data members
+    ProcessListData m_currentData;
+    SnapshotBuffer<ProcessListData> m_snapshot;     // Published copy of m_currentData
+    QVector<ProcessListData> m_history;
+    int m_maxHistorySize;
+    int m_topCount;
+
+    // Process table
+    PidMap<ProcessSample> m_processes;
+    std::vector<Ranked> m_heap;     // Reused by selectTop()
+    quint32 m_tick;
+    int m_threadCount;
+    int m_runningCount;
+    double m_totalCpuUsage;
+    qint64 m_sampleNs;
+    qint64 m_intervalNs;
+
+    // Process events (null listener: polling)
+    std::unique_ptr<ProcEventListener> m_eventListener;
+    std::vector<ProcEvent> m_events;
+    bool m_eventDriven;             // Requested
+    bool m_eventsUnavailable;       // Refused or not delivered, stop retrying
+    quint64 m_eventsReceived;
+    quint64 m_listenStartTicks;     // bootTicks(), comparable to start times
+    quint64 m_eventHorizonTicks;    // Last drain
+    qint64 m_reconcileIntervalNs;
+    qint64 m_lastReconcileNs;
+
+    // System constants
+    long m_clockTicks;          // sysconf(_SC_CLK_TCK)
+    qint64 m_pageSize;
+
+    // Persistent /proc descriptor and reused buffers
+    QByteArray m_procPath;
+    int m_procFd;
+    std::vector<char> m_direntBuffer;
+    std::vector<char> m_fileBuffer;
+};
+
+#endif // PROCESSMONITOR_H
@@ -0,0 +1,604 @@
+/**
+ * @file storagemonitor.cpp
+ * @brief Storage capacity and block device I/O monitoring implementation
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#include "storagemonitor.h"
+#include "core/constants.h"
+#include "core/sampleclock.h"
+#include "core/systeminfocache.h"
+#include <QDebug>
+#include <QFile>
+#include <QLatin1String>
+#include <QtMath>
+#include <dirent.h>
+#include <poll.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <sys/sysmacros.h>
+#include <unistd.h>
+#include <utility>
+
+namespace {
+
+// How a block device relates to the physical disks
+enum DeviceKind : char {
+    WholeDisk = 0,      // Counted in the totals
+    Partition,          // Its disk already counts its I/O
+    Stacked             // dm, md, loop: I/O lands on other devices too
+};
+
+// Path lies on the filesystem mounted at mountPoint, or below it
+bool isWithin(const QString& path, const QString& mountPoint)
+{
+    if (mountPoint == QLatin1String("/")) return path.startsWith('/');
+    return path == mountPoint ||
+           (path.startsWith(mountPoint) && path.at(mountPoint.length()) == '/');
+}
+
+bool hasEntries(const char* directory)
+{
+    DIR* dir = ::opendir(directory);
+    if (!dir) return false;
+
+    bool found = false;
+    while (dirent* entry = ::readdir(dir)) {
+        if (entry->d_name[0] != '.') {
+            found = true;
+            break;
+        }
+    }
+    ::closedir(dir);
+    return found;
+}
+
+} // namespace
+
+/**
+ * @brief Capacity and device number of one mount point
+ * Written by the watchdog worker, read by the collector only when the
+ * source is fresh (see SourceWatchdog's ownership rule).
+ */
+struct StorageMonitor::MountSource {
+    QByteArray path;
+    qint64 totalSpace;
+    qint64 usedSpace;
+    qint64 availableSpace;
+    unsigned int devMajor;
+    unsigned int devMinor;
+
+    explicit MountSource(const QString& mountPoint)
+        : path(QFile::encodeName(mountPoint))
+        , totalSpace(0), usedSpace(0), availableSpace(0)
+        , devMajor(0), devMinor(0) {}
+
+    // May block for as long as the filesystem does
+    bool read()
+    {
+        struct stat info;
+        struct statvfs fs;
+        if (::stat(path.constData(), &info) != 0 || ::statvfs(path.constData(), &fs) != 0) {
+            return false;
+        }
+
+        // Used as df counts it: blocks reserved for root are neither
+        // used nor available
+        const qint64 blockSize = static_cast<qint64>(fs.f_frsize ? fs.f_frsize : fs.f_bsize);
+        totalSpace = static_cast<qint64>(fs.f_blocks) * blockSize;
+        usedSpace = static_cast<qint64>(fs.f_blocks - fs.f_bfree) * blockSize;
+        availableSpace = static_cast<qint64>(fs.f_bavail) * blockSize;
+        devMajor = major(info.st_dev);
+        devMinor = minor(info.st_dev);
+        return true;
+    }
+};
+
+StorageMonitor::StorageMonitor(QObject *parent)
+    : BaseMonitor(parent)
+    , m_maxHistorySize(MAX_HISTORY_SIZE)
+    , m_storagePaths(STORAGE_PATHS)
+    , m_mountTableValid(false)
+    , m_capacityCollected(false)
+    , m_capacityIntervalNs(SLOW_UPDATE_INTERVAL * 1000000LL)
+    , m_lastCapacityNs(0)
+    , m_layoutChanged(true)
+    , m_wideCounters(SystemInfoCache::is64BitKernel())
+    , m_sampleNs(0)
+    , m_intervalNs(0)
+    , m_diskStatsReader(PROC_DISKSTATS, 8192)
+    , m_mountsReader(PROC_MOUNTS, 8192)
+{
+    setUpdateInterval(DISK_UPDATE_INTERVAL);
+    m_snapshot.publish(m_currentData);
+}
+
+StorageMonitor::~StorageMonitor() = default;
+
+StorageData StorageMonitor::getCurrentData() const
+{
+    // Never waits for the collector, which holds m_dataMutex for a whole tick
+    return m_snapshot.read();
+}
+
+QVector<StorageData> StorageMonitor::getHistory() const
+{
+    QMutexLocker locker(&m_dataMutex);
+    return m_history;
+}
+
+void StorageMonitor::setHistorySize(int size)
+{
+    m_maxHistorySize = qBound(10, size, 1000);
+}
+
+void StorageMonitor::setStoragePaths(const QStringList &paths)
+{
+    QMutexLocker locker(&m_dataMutex);
+    m_storagePaths = paths;
+    resetCollectedState();
+}
+
+void StorageMonitor::setCapacityInterval(int intervalMs)
+{
+    QMutexLocker locker(&m_dataMutex);
+    m_capacityIntervalNs = static_cast<qint64>(qMax(MIN_UPDATE_INTERVAL, intervalMs)) * 1000000LL;
+    resetCollectedState();
+}
+
+void StorageMonitor::setDiskStatsPath(const QString &path)
+{
+    QMutexLocker locker(&m_dataMutex);
+    m_diskStatsReader.setFilePath(path);
+    resetCollectedState();
+}
+
+void StorageMonitor::setMountsPath(const QString &path)
+{
+    QMutexLocker locker(&m_dataMutex);
+    m_mountsReader.setFilePath(path);
+    resetCollectedState();
+}
+
+void StorageMonitor::collectData()
+{
+    const qint64 nowNs = SampleClock::nowNs();
+    m_currentData.timestampNs = nowNs;
+
+    if (!m_mountTableValid || mountTableChanged()) {
+        refreshMountTable();
+    }
+
+    // Capacity at its own slow cadence, never waiting on a hung mount
+    m_capacityCollected = false;
+    if (m_capacityWatchdog && (m_lastCapacityNs == 0 || nowNs - m_lastCapacityNs >= m_capacityIntervalNs)) {
+        m_capacityWatchdog->collect();
+        m_lastCapacityNs = nowNs;
+        m_capacityCollected = true;
+    }
+
+    // No counters this tick: no rates, the next read spans both intervals
+    if (m_diskStatsReader.read() <= 0) {
+        m_intervalNs = 0;
+        return;
+    }
+
+    // Swapping keeps both vectors' capacity, the parser writes in place
+    std::swap(m_previousStats, m_stats);
+    ProcParser::parseDiskStats(m_diskStatsReader.data(), m_diskStatsReader.size(), m_stats);
+
+    // Rates use the real time between reads, not the nominal interval
+    m_intervalNs = (m_sampleNs > 0) ? nowNs - m_sampleNs : 0;
+    m_sampleNs = nowNs;
+}
+
+void StorageMonitor::processData()
+{
+    updateMounts();
+
+    const double intervalMs = m_intervalNs / 1e6;
+    const int count = static_cast<int>(m_stats.size());
+
+    // Device kinds come from sysfs: only looked up again on churn
+    if (!m_layoutChanged) {
+        m_layoutChanged = m_stats.size() != m_previousStats.size();
+        for (int i = 0; i < count && !m_layoutChanged; ++i) {
+            m_layoutChanged = !m_stats[static_cast<size_t>(i)].sameDevice(m_previousStats[static_cast<size_t>(i)]);
+        }
+    }
+    if (m_layoutChanged) {
+        refreshDeviceKinds();
+        m_layoutChanged = false;
+    }
+
+    // Upper bound, trimmed to the listed devices below
+    m_currentData.blockDevices.resize(count);
+    BlockDeviceData* devices = m_currentData.blockDevices.data();
+
+    double readSpeed = 0.0;
+    double writeSpeed = 0.0;
+    double iops = 0.0;
+    double peak = 0.0;
+    int busiest = -1;
+    int listed = 0;
+
+    for (int i = 0; i < count; ++i) {
+        const DiskStat& stat = m_stats[static_cast<size_t>(i)];
+
+        // Never used (ram0-15, unattached loop devices): not worth a row
+        if (stat.counters[DiskStat::ReadsCompleted] == 0 && stat.counters[DiskStat::WritesCompleted] == 0) {
+            continue;
+        }
+
+        BlockDeviceData& data = devices[listed++];
+        const char kind = m_deviceKinds[static_cast<size_t>(i)];
+        data.isPartition = kind == Partition;
+        updateBlockDevice(data, stat, findPrevious(i), intervalMs);
+
+        // Physical disks only, anything else would count I/O twice
+        if (kind != WholeDisk) continue;
+
+        readSpeed += data.readSpeed;
+        writeSpeed += data.writeSpeed;
+        iops += data.readIops + data.writeIops;
+        if (data.utilization > peak) {
+            peak = data.utilization;
+            busiest = listed - 1;
+        }
+    }
+    m_currentData.blockDevices.resize(listed);
+
+    m_currentData.totalReadSpeed = readSpeed;
+    m_currentData.totalWriteSpeed = writeSpeed;
+    m_currentData.totalIops = iops;
+    m_currentData.peakUtilization = peak;
+    if (busiest >= 0) {
+        m_currentData.busiestDevice = m_currentData.blockDevices.at(busiest).name;
+    } else if (!m_currentData.busiestDevice.isEmpty()) {
+        m_currentData.busiestDevice.clear();
+    }
+
+    m_currentData.status = determineStatus();
+}
+
+void StorageMonitor::validateData()
+{
+    double* totals[] = {
+        &m_currentData.totalReadSpeed, &m_currentData.totalWriteSpeed,
+        &m_currentData.totalIops, &m_currentData.peakUtilization
+    };
+    for (double* total : totals) {
+        if (!qIsFinite(*total) || *total < 0.0) {
+            *total = 0.0;
+        }
+    }
+
+    if (!qIsFinite(m_currentData.totalUsagePercentage)) {
+        m_currentData.totalUsagePercentage = 0.0;
+    }
+    m_currentData.totalUsagePercentage = qBound(0.0, m_currentData.totalUsagePercentage, 100.0);
+}
+
+void StorageMonitor::emitSignal()
+{
+    m_snapshot.publish(m_currentData);
+    emit storageDataUpdated(m_currentData);
+
+    // Emit threshold warnings
+    for (const StorageDeviceData& mount : m_currentData.devices) {
+        if (mount.status == MetricStatus::Critical) {
+            emit storageCritical(mount.path, mount.usagePercentage);
+        } else if (mount.status == MetricStatus::Warning) {
+            emit storageWarning(mount.path, mount.usagePercentage);
+        }
+    }
+    if (m_currentData.peakUtilization >= DISK_BUSY_WARNING_THRESHOLD) {
+        emit diskBusyWarning(m_currentData.busiestDevice, m_currentData.peakUtilization);
+    }
+
+    // History keeps mounts and totals; loop devices of snaps and
+    // containers can make the block device list long
+    StorageData entry = m_currentData;
+    entry.blockDevices.clear();
+    m_history.append(entry);
+    if (m_history.size() > m_maxHistorySize) {
+        m_history.removeFirst();
+    }
+}
+
+qint64 StorageMonitor::memoryFootprint() const
+{
+    qint64 bytes = static_cast<qint64>(m_stats.capacity() + m_previousStats.capacity()) * sizeof(DiskStat);
+    bytes += static_cast<qint64>(m_deviceKinds.capacity());
+    bytes += m_currentData.blockDevices.capacity() * static_cast<qint64>(sizeof(BlockDeviceData));
+    bytes += m_currentData.devices.capacity() * static_cast<qint64>(sizeof(StorageDeviceData));
+    bytes += m_mountTable.capacity() * static_cast<qint64>(sizeof(MountEntry));
+    bytes += m_history.capacity() * static_cast<qint64>(sizeof(StorageData));
+    bytes += m_diskStatsReader.capacity() + m_mountsReader.capacity();
+    return bytes;
+}
+
+// ===================================================================
+// DATA COLLECTION
+// ===================================================================
+
+bool StorageMonitor::mountTableChanged() const
+{
+    // /proc/mounts reports a mount or unmount as POLLPRI | POLLERR;
+    // a plain file (tests) never does
+    if (!m_mountsReader.isOpen()) return false;
+
+    pollfd watch = { m_mountsReader.fd(), POLLPRI, 0 };
+    return ::poll(&watch, 1, 0) > 0 && (watch.revents & (POLLPRI | POLLERR));
+}
+
+void StorageMonitor::refreshMountTable()
+{
+    m_mountTableValid = true;
+
+    // The read opens the descriptor mountTableChanged() polls
+    m_mountTable.clear();
+    if (m_mountsReader.read() > 0) {
+        ProcParser::parseMounts(m_mountsReader.data(), m_mountsReader.size(), m_mountTable);
+    }
+
+    // Each path lives on the longest mount point above it; of equal
+    // ones the last, which is on top of those it shadows
+    std::vector<Mount> mounts;
+    for (const QString& path : m_storagePaths) {
+        int best = -1;
+        for (int i = 0; i < m_mountTable.size(); ++i) {
+            const QString& mountPoint = m_mountTable.at(i).mountPoint;
+            if (isWithin(path, mountPoint) &&
+                (best < 0 || mountPoint.length() >= m_mountTable.at(best).mountPoint.length())) {
+                best = i;
+            }
+        }
+
+        Mount mount;
+        mount.path = path;
+        mount.mountPoint = (best >= 0) ? m_mountTable.at(best).mountPoint : path;
+        mount.filesystem = (best >= 0) ? m_mountTable.at(best).fileSystem : QString();
+        mount.sourceId = -1;
+        mount.devMajor = 0;
+        mount.devMinor = 0;
+
+        // Paths on one filesystem are reported once
+        bool duplicate = false;
+        for (const Mount& other : mounts) {
+            duplicate = duplicate || other.mountPoint == mount.mountPoint;
+        }
+        if (!duplicate) mounts.push_back(mount);
+    }
+
+    // Same mounts as before: keep the sources and their stale state
+    bool unchanged = m_capacityWatchdog && mounts.size() == m_mounts.size();
+    for (size_t i = 0; unchanged && i < mounts.size(); ++i) {
+        unchanged = mounts[i].mountPoint == m_mounts[i].mountPoint &&
+                    mounts[i].filesystem == m_mounts[i].filesystem;
+    }
+    if (unchanged) return;
+
+    // New sources; hung workers of the old watchdog are detached
+    m_capacityWatchdog = std::make_unique<SourceWatchdog>();
+    for (Mount& mount : mounts) {
+        std::shared_ptr<MountSource> source = std::make_shared<MountSource>(mount.mountPoint);
+        mount.source = source;
+        mount.sourceId = m_capacityWatchdog->addSource("statvfs " + mount.mountPoint,
+                                                       [source] { return source->read(); });
+    }
+    m_mounts = std::move(mounts);
+    m_lastCapacityNs = 0;
+
+    m_currentData.devices.resize(static_cast<int>(m_mounts.size()));
+    for (size_t i = 0; i < m_mounts.size(); ++i) {
+        StorageDeviceData& data = m_currentData.devices[static_cast<int>(i)];
+        data = StorageDeviceData();
+        data.path = m_mounts[i].mountPoint;
+        data.filesystem = m_mounts[i].filesystem;
+    }
+}
+
+void StorageMonitor::resetCollectedState()
+{
+    m_mounts.clear();
+    m_capacityWatchdog.reset();
+    m_mountTable.clear();
+    m_mountTableValid = false;
+    m_lastCapacityNs = 0;
+
+    m_stats.clear();
+    m_previousStats.clear();
+    m_deviceKinds.clear();
+    m_layoutChanged = true;
+    m_sampleNs = 0;
+    m_intervalNs = 0;
+    m_currentData = StorageData();
+}
+
+// ===================================================================
+// CALCULATIONS
+// ===================================================================
+
+void StorageMonitor::updateMounts()
+{
+    qint64 used = 0;
+    qint64 usable = 0;
+
+    for (size_t i = 0; i < m_mounts.size(); ++i) {
+        Mount& mount = m_mounts[i];
+        StorageDeviceData& data = m_currentData.devices[static_cast<int>(i)];
+
+        if (m_capacityCollected) {
+            if (m_capacityWatchdog->isFresh(mount.sourceId)) {
+                const MountSource& source = *mount.source;
+                data.totalSpace = source.totalSpace;
+                data.usedSpace = source.usedSpace;
+                data.availableSpace = source.availableSpace;
+                const qint64 capacity = source.usedSpace + source.availableSpace;
+                data.usagePercentage = (capacity > 0) ? 100.0 * source.usedSpace / capacity : 0.0;
+                data.timestampNs = m_currentData.timestampNs;
+                mount.devMajor = source.devMajor;
+                mount.devMinor = source.devMinor;
+            }
+
+            // Hung or failing: last known capacity, flagged Unknown
+            data.status = (m_capacityWatchdog->status(mount.sourceId) == MetricStatus::Normal)
+                              ? mountStatus(data) : MetricStatus::Unknown;
+        }
+
+        // Backing device by device number: /dev/root and mapper links
+        // have no name of their own in /proc/diskstats
+        const DiskStat* disk = nullptr;
+        for (const DiskStat& stat : m_stats) {
+            if (mount.devMajor != 0 && stat.devMajor == mount.devMajor && stat.devMinor == mount.devMinor) {
+                disk = &stat;
+                break;
+            }
+        }
+        const QLatin1String device = disk ? QLatin1String(disk->name, disk->nameLength) : QLatin1String("");
+        if (data.device != device) {
+            data.device = device;
+        }
+
+        used += data.usedSpace;
+        usable += data.usedSpace + data.availableSpace;
+    }
+
+    m_currentData.totalUsagePercentage = (usable > 0) ? 100.0 * used / usable : 0.0;
+}
+
+const DiskStat* StorageMonitor::findPrevious(int index)
+{
+    const DiskStat& stat = m_stats[static_cast<size_t>(index)];
+
+    // Same slot as last time: the common case, no lookup
+    if (static_cast<size_t>(index) < m_previousStats.size() &&
+        m_previousStats[static_cast<size_t>(index)].sameDevice(stat)) {
+        return &m_previousStats[static_cast<size_t>(index)];
+    }
+
+    // Devices came or went. Block devices number in the tens to
+    // hundreds, a scan on churn ticks is cheaper than keeping an index
+    for (const DiskStat& previous : m_previousStats) {
+        if (previous.sameDevice(stat)) return &previous;
+    }
+    return nullptr;
+}
+
+void StorageMonitor::refreshDeviceKinds()
+{
+    m_deviceKinds.assign(m_stats.size(), WholeDisk);
+
+    QByteArray path = QFile::encodeName(BLOCK_CLASS_PATH) + '/';
+    const int base = path.size();
+    for (size_t i = 0; i < m_stats.size(); ++i) {
+        const DiskStat& stat = m_stats[i];
+
+        // sysfs spells '/' in device names as '!' (cciss/c0d0)
+        path.truncate(base);
+        path.append(stat.name, stat.nameLength);
+        for (int c = base; c < path.size(); ++c) {
+            if (path[c] == '/') path[c] = '!';
+        }
+        const int deviceEnd = path.size();
+
+        path.append("/partition");
+        if (::access(path.constData(), F_OK) == 0) {
+            m_deviceKinds[i] = Partition;
+            continue;
+        }
+
+        path.truncate(deviceEnd);
+        path.append("/loop");
+        const bool loop = ::access(path.constData(), F_OK) == 0;
+
+        path.truncate(deviceEnd);
+        path.append("/slaves");
+        if (loop || hasEntries(path.constData())) {
+            m_deviceKinds[i] = Stacked;
+        }
+    }
+}
+
+void StorageMonitor::updateBlockDevice(BlockDeviceData &data, const DiskStat &stat,
+                                       const DiskStat *previous, double intervalMs)
+{
+    const QLatin1String name(stat.name, stat.nameLength);
+    if (data.name != name) {
+        data.name = name;
+    }
+
+    const quint64* counters = stat.counters;
+    data.inFlight = static_cast<int>(counters[DiskStat::InFlight]);
+    data.timestampNs = m_currentData.timestampNs;
+
+    // New device or first sample: no rates yet
+    if (!previous || intervalMs <= 0.0) {
+        data.readSpeed = data.writeSpeed = 0.0;
+        data.readIops = data.writeIops = 0.0;
+        data.serviceTime = data.queueDepth = data.utilization = 0.0;
+        return;
+    }
+
+    // Requests and sectors are unsigned long, as wide as the kernel's
+    // word; the ms fields are printed with %u and wrap at 2^32 everywhere
+    const quint64* before = previous->counters;
+    auto delta = [&](int counter) {
+        return ProcParser::counterDelta(before[counter], counters[counter], m_wideCounters);
+    };
+    auto msDelta = [&](int counter) {
+        return ProcParser::counterDelta(before[counter], counters[counter], false);
+    };
+
+    const double perSecond = 1000.0 / intervalMs;
+    const quint64 reads = delta(DiskStat::ReadsCompleted);
+    const quint64 writes = delta(DiskStat::WritesCompleted);
+    const quint64 requests = reads + writes + delta(DiskStat::DiscardsCompleted);
+    const quint64 busyMs = msDelta(DiskStat::IoTimeMs);
+
+    data.readSpeed = delta(DiskStat::SectorsRead) * static_cast<double>(DiskStat::SECTOR_SIZE) * perSecond;
+    data.writeSpeed = delta(DiskStat::SectorsWritten) * static_cast<double>(DiskStat::SECTOR_SIZE) * perSecond;
+    data.readIops = reads * perSecond;
+    data.writeIops = writes * perSecond;
+
+    // "ms doing I/O" counts wall time with at least one request in
+    // flight; the weighted time counts every request's share of it
+    data.serviceTime = (requests > 0) ? static_cast<double>(busyMs) / requests : 0.0;
+    data.queueDepth = msDelta(DiskStat::WeightedIoTimeMs) / intervalMs;
+    data.utilization = qMin(100.0, busyMs * 100.0 / intervalMs);
+}
+
+MetricStatus StorageMonitor::mountStatus(const StorageDeviceData &mount) const
+{
+    if (mount.totalSpace <= 0) {
+        return MetricStatus::Unknown;
+    }
+    if (mount.usagePercentage >= STORAGE_CRITICAL_THRESHOLD) {
+        return MetricStatus::Critical;
+    }
+    if (mount.usagePercentage >= STORAGE_WARNING_THRESHOLD) {
+        return MetricStatus::Warning;
+    }
+    return MetricStatus::Normal;
+}
+
+MetricStatus StorageMonitor::determineStatus() const
+{
+    // Worst mount; MetricStatus is ordered Unknown < Normal < Warning < Critical
+    MetricStatus status = MetricStatus::Unknown;
+    for (const StorageDeviceData& mount : m_currentData.devices) {
+        status = qMax(status, mount.status);
+    }
+
+    // A saturated disk is a warning whatever the free space
+    if (m_currentData.peakUtilization >= DISK_BUSY_WARNING_THRESHOLD) {
+        return qMax(status, MetricStatus::Warning);
+    }
+    if (status == MetricStatus::Unknown && !m_currentData.blockDevices.isEmpty()) {
+        return MetricStatus::Normal;
+    }
+
+    return status;
+}
@@ -0,0 +1,132 @@
+/**
+ * @file storagemonitor.h
+ * @brief Storage capacity and block device I/O monitoring
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#ifndef STORAGEMONITOR_H
+#define STORAGEMONITOR_H
+
+#include "model/base/basemonitor.h"
+#include "core/types.h"
+#include "core/procfilereader.h"
+#include "core/procparser.h"
+#include "core/snapshotbuffer.h"
+#include "core/sourcewatchdog.h"
+#include <QStringList>
+#include <QVector>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Mount capacity from statvfs() plus per-device I/O from /proc/diskstats
+ *
+ * Every tick (DISK_UPDATE_INTERVAL) reads /proc/diskstats once and turns
+ * the counter deltas over the real monotonic interval into throughput,
+ * IOPS, average service time (busy ms per request), average queue depth
+ * and utilization. Devices are matched to the previous sample like
+ * network interfaces: by position, by major:minor after churn. Request
+ * and sector counters are unsigned long, so whether their decrease is a
+ * 32-bit wrap or a reset (re-added disk) follows from the kernel's word
+ * size. The ms fields are 32 bits on every kernel and always wrap.
+ *
+ * Capacity changes slowly and statvfs() on a dead network mount can
+ * block forever, so the mount points behind STORAGE_PATHS are resolved
+ * once from /proc/mounts (again only when poll() reports a mount table
+ * change) and each is read through a SourceWatchdog source every
+ * SLOW_UPDATE_INTERVAL. A hung mount keeps its last capacity with
+ * status Unknown and does not hold up the tick.
+ */
+class StorageMonitor : public BaseMonitor
+{
+    Q_OBJECT
+public:
+    explicit StorageMonitor(QObject *parent = nullptr);
+    ~StorageMonitor() override;
+
+    // Data access (getCurrentData() is lock-free, callable from any thread)
+    StorageData getCurrentData() const;
+    QVector<StorageData> getHistory() const;    // Without block device lists
+    void setHistorySize(int size);
+
+    // Configuration, each resets the collected state
+    void setStoragePaths(const QStringList& paths);
+    void setCapacityInterval(int intervalMs);
+
+    // Read other files in /proc format (tests, other namespaces)
+    void setDiskStatsPath(const QString& path);
+    void setMountsPath(const QString& path);
+
+signals:
+    void storageDataUpdated(const StorageData& data);
+    void storageWarning(const QString& path, double usagePercent);
+    void storageCritical(const QString& path, double usagePercent);
+    void diskBusyWarning(const QString& device, double utilization);
+
+protected:
+    // Template Method implementation
+    void collectData() override;
+    void processData() override;
+    void validateData() override;
+    void emitSignal() override;
+    qint64 memoryFootprint() const override;
+
+private:
+    struct MountSource;     // statvfs() result, written by a watchdog worker
+
+    struct Mount {
+        QString path;               // Configured path
+        QString mountPoint;
+        QString filesystem;
+        std::shared_ptr<MountSource> source;
+        int sourceId;
+        unsigned int devMajor;      // Filesystem device, from the last fresh read
+        unsigned int devMinor;
+    };
+
+    // Data collection
+    bool mountTableChanged() const;
+    void refreshMountTable();
+    void resetCollectedState();
+
+    // Calculations
+    void updateMounts();
+    const DiskStat* findPrevious(int index);
+    void refreshDeviceKinds();
+    void updateBlockDevice(BlockDeviceData& data, const DiskStat& stat,
+                           const DiskStat* previous, double intervalMs);
+    MetricStatus mountStatus(const StorageDeviceData& mount) const;
+    MetricStatus determineStatus() const;
+
+    // Data members
+    StorageData m_currentData;
+    SnapshotBuffer<StorageData> m_snapshot;     // Published copy of m_currentData
+    QVector<StorageData> m_history;
+    int m_maxHistorySize;
+
+    // Mounts behind the configured paths, one watchdog source each
+    QStringList m_storagePaths;
+    std::vector<Mount> m_mounts;
+    std::unique_ptr<SourceWatchdog> m_capacityWatchdog;
+    QVector<MountEntry> m_mountTable;
+    bool m_mountTableValid;
+    bool m_capacityCollected;       // This tick ran the watchdog
+    qint64 m_capacityIntervalNs;
+    qint64 m_lastCapacityNs;
+
+    // Raw counters of this and the previous read, in file order
+    std::vector<DiskStat> m_stats;
+    std::vector<DiskStat> m_previousStats;
+    std::vector<char> m_deviceKinds;    // Per m_stats entry, refreshed on churn
+    bool m_layoutChanged;
+    bool m_wideCounters;            // Kernel unsigned long is 64 bits, fixed at construction
+    qint64 m_sampleNs;
+    qint64 m_intervalNs;
+
+    // Persistent readers; /proc/mounts is only read after a change
+    ProcFileReader m_diskStatsReader;
+    ProcFileReader m_mountsReader;
+};
+
+#endif // STORAGEMONITOR_H
@@ -0,0 +1,130 @@
+/**
+ * @file systemloadmonitor.cpp
+ * @brief System load, task count and uptime monitoring implementation
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#include "systemloadmonitor.h"
+#include "core/constants.h"
+#include "core/sampleclock.h"
+#include "core/systeminfocache.h"
+#include <QtMath>
+
+SystemLoadMonitor::SystemLoadMonitor(QObject *parent)
+    : BaseMonitor(parent)
+    , m_maxHistorySize(MAX_HISTORY_SIZE)
+    , m_uptimeSeconds(0.0)
+    , m_loadAvgReader(PROC_LOADAVG, 256)
+    , m_uptimeReader(PROC_UPTIME, 128)
+{
+    setUpdateInterval(SLOW_UPDATE_INTERVAL);
+
+    m_readBatch.addReader(&m_loadAvgReader);
+    m_readBatch.addReader(&m_uptimeReader);
+
+    // Static facts, collected once for the whole process
+    const SystemInfo info = SystemInfoCache::info();
+    m_currentData.hostname = info.hostname;
+    m_currentData.kernelVersion = info.kernelVersion;
+    m_currentData.architecture = info.architecture;
+    m_currentData.bootTime = info.bootTime;
+
+    m_snapshot.publish(m_currentData);
+}
+
+SystemData SystemLoadMonitor::getCurrentData() const
+{
+    // Never waits for the collector, which holds m_dataMutex for a whole tick
+    return m_snapshot.read();
+}
+
+QVector<SystemData> SystemLoadMonitor::getHistory() const
+{
+    QMutexLocker locker(&m_dataMutex);
+    return m_history;
+}
+
+void SystemLoadMonitor::setHistorySize(int size)
+{
+    m_maxHistorySize = qBound(10, size, 1000);
+}
+
+void SystemLoadMonitor::setProcPaths(const QString &loadAvgPath, const QString &uptimePath)
+{
+    QMutexLocker locker(&m_dataMutex);
+    m_loadAvgReader.setFilePath(loadAvgPath);
+    m_uptimeReader.setFilePath(uptimePath);
+
+    m_readBatch.clear();
+    m_readBatch.addReader(&m_loadAvgReader);
+    m_readBatch.addReader(&m_uptimeReader);
+
+    m_loadAvg = LoadAvgStat();
+    m_uptimeSeconds = 0.0;
+}
+
+void SystemLoadMonitor::collectData()
+{
+    // Both files with one submission (or two preads)
+    m_readBatch.readAll();
+    m_currentData.timestampNs = SampleClock::nowNs();
+
+    // A file that failed to read or parse keeps its previous values
+    LoadAvgStat load;
+    if (m_loadAvgReader.size() > 0 &&
+        ProcParser::parseLoadAvg(m_loadAvgReader.data(), m_loadAvgReader.size(), load)) {
+        m_loadAvg = load;
+    }
+
+    double uptimeSeconds = 0.0;
+    if (m_uptimeReader.size() > 0 &&
+        ProcParser::parseUptime(m_uptimeReader.data(), m_uptimeReader.size(), &uptimeSeconds)) {
+        m_uptimeSeconds = uptimeSeconds;
+    }
+}
+
+void SystemLoadMonitor::processData()
+{
+    m_currentData.loadAverage1min = m_loadAvg.load1;
+    m_currentData.loadAverage5min = m_loadAvg.load5;
+    m_currentData.loadAverage15min = m_loadAvg.load15;
+    m_currentData.runningProcesses = m_loadAvg.runningTasks;
+    m_currentData.processCount = m_loadAvg.totalTasks;
+    m_currentData.uptime = static_cast<qint64>(m_uptimeSeconds);
+}
+
+void SystemLoadMonitor::validateData()
+{
+    double* averages[] = {
+        &m_currentData.loadAverage1min, &m_currentData.loadAverage5min,
+        &m_currentData.loadAverage15min
+    };
+    for (double* average : averages) {
+        if (!qIsFinite(*average) || *average < 0.0) {
+            *average = 0.0;
+        }
+    }
+
+    m_currentData.runningProcesses = qMax(0, m_currentData.runningProcesses);
+    m_currentData.processCount = qMax(m_currentData.runningProcesses, m_currentData.processCount);
+    m_currentData.uptime = qMax<qint64>(0, m_currentData.uptime);
+}
+
+void SystemLoadMonitor::emitSignal()
+{
+    m_snapshot.publish(m_currentData);
+    emit systemDataUpdated(m_currentData);
+
+    m_history.append(m_currentData);
+    if (m_history.size() > m_maxHistorySize) {
+        m_history.removeFirst();
+    }
+}
+
+qint64 SystemLoadMonitor::memoryFootprint() const
+{
+    qint64 bytes = m_history.capacity() * static_cast<qint64>(sizeof(SystemData));
+    bytes += m_loadAvgReader.capacity() + m_uptimeReader.capacity();
+    return bytes;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file systemloadmonitor.h
+ * @brief System load, task count and uptime monitoring
+ * @author TungNHS
+ * @version 1.0.0
+ */
+
+#ifndef SYSTEMLOADMONITOR_H
+#define SYSTEMLOADMONITOR_H
+
+#include "model/base/basemonitor.h"
+#include "core/types.h"
+#include "core/procfilereader.h"
+#include "core/procparser.h"
+#include "core/procreadbatch.h"
+#include "core/snapshotbuffer.h"
+#include <QVector>
+
+/**
+ * @brief Fills SystemData from /proc/loadavg and /proc/uptime
+ *
+ * Both files are read together once per SLOW_UPDATE_INTERVAL tick
+ * through one ProcReadBatch; /proc/loadavg already carries the
+ * runnable and total task counts, so no /proc scan is needed for them.
+ * Hostname, kernel, architecture and boot time never change while the
+ * system runs and come from SystemInfoCache once, at construction.
+ */
+class SystemLoadMonitor : public BaseMonitor
+{
+    Q_OBJECT
+public:
+    explicit SystemLoadMonitor(QObject *parent = nullptr);
+
+    // Data access (getCurrentData() is lock-free, callable from any thread)
+    SystemData getCurrentData() const;
+    QVector<SystemData> getHistory() const;
+    void setHistorySize(int size);
+
+    // Read other files in /proc format (tests, other namespaces)
+    void setProcPaths(const QString& loadAvgPath, const QString& uptimePath);
+
+signals:
+    void systemDataUpdated(const SystemData& data);
+
+protected:
+    // Template Method implementation
+    void collectData() override;
+    void processData() override;
+    void validateData() override;
+    void emitSignal() override;
+    qint64 memoryFootprint() const override;
+
+private:
+    // Data members
+    SystemData m_currentData;
+    SnapshotBuffer<SystemData> m_snapshot;      // Published copy of m_currentData
+    QVector<SystemData> m_history;
+    int m_maxHistorySize;
+
+    // Raw values of the last read
+    LoadAvgStat m_loadAvg;
+    double m_uptimeSeconds;
+
+    // Persistent readers, refreshed with one batch per tick
+    ProcFileReader m_loadAvgReader;
+    ProcFileReader m_uptimeReader;
+    ProcReadBatch m_readBatch;
+};
+
+#endif // SYSTEMLOADMONITOR_H
@@ -8,7 +8,26 @@
 #include <QDebug>
 
 #include "unit/test_systemutils.h"
+#include "unit/test_procparser.h"
+#include "unit/test_cpukernels.h"
+#include "unit/test_systeminfocache.h"
+#include "unit/test_procreadbatch.h"
+#include "unit/test_sampleclock.h"
+#include "unit/test_snapshotbuffer.h"
+#include "unit/test_latencyhistogram.h"
+#include "unit/test_sourcewatchdog.h"
+#include "unit/test_thermalsampler.h"
+#include "unit/test_cpufrequencysampler.h"
+#include "unit/test_basemonitor.h"
+#include "unit/test_coalescingmailbox.h"
 #include "unit/test_cpumonitor.h"
+#include "unit/test_networkmonitor.h"
+#include "unit/test_storagemonitor.h"
+#include "unit/test_systemloadmonitor.h"
+#include "unit/test_processmonitor.h"
+#include "unit/test_pidmap.h"
+#include "unit/test_proceventlistener.h"
+#include "unit/test_samplingscheduler.h"
 
 int main(int argc, char *argv[])
 {
@@ -24,12 +43,88 @@ int main(int argc, char *argv[])
         TestSystemUtils test;
         result += QTest::qExec(&test, argc, argv);
     }
+    {
+        TestProcParser test;
+        result += QTest::qExec(&test, argc, argv);
+    }
+    {
+        TestCPUKernels test;
+        result += QTest::qExec(&test, argc, argv);
+    }
+    {
+        TestSystemInfoCache test;
+        result += QTest::qExec(&test, argc, argv);
+    }
+    {
+        TestProcReadBatch test;
+        result += QTest::qExec(&test, argc, argv);
+    }
+    {
+        TestSampleClock test;
+        result += QTest::qExec(&test, argc, argv);
+    }
+    {
+        TestSnapshotBuffer test;
+        result += QTest::qExec(&test, argc, argv);
+    }
+    {
+        TestLatencyHistogram test;
+        result += QTest::qExec(&test, argc, argv);
+    }
+    {
+        TestSourceWatchdog test;
+        result += QTest::qExec(&test, argc, argv);
+    }
+    {
+        TestThermalSampler test;
+        result += QTest::qExec(&test, argc, argv);
+    }
+    {
+        TestCPUFrequencySampler test;
+        result += QTest::qExec(&test, argc, argv);
+    }
     // Phase 2 Tests
     qDebug() << "\n--- Phase 2: Monitoring Classes Tests ---";
+    {
+        TestBaseMonitor test;
+        result += QTest::qExec(&test, argc, argv);
+    }
+    {
+        TestCoalescingMailbox test;
+        result += QTest::qExec(&test, argc, argv);
+    }
     {
         TestCPUMonitor test;
         result += QTest::qExec(&test, argc, argv);
     }
+    {
+        TestNetworkMonitor test;
+        result += QTest::qExec(&test, argc, argv);
+    }
+    {
+        TestStorageMonitor test;
+        result += QTest::qExec(&test, argc, argv);
+    }
+    {
+        TestSystemLoadMonitor test;
+        result += QTest::qExec(&test, argc, argv);
+    }
+    {
+        TestPidMap test;
+        result += QTest::qExec(&test, argc, argv);
+    }
+    {
+        TestProcEventListener test;
+        result += QTest::qExec(&test, argc, argv);
+    }
+    {
+        TestProcessMonitor test;
+        result += QTest::qExec(&test, argc, argv);
+    }
+    {
+        TestSamplingScheduler test;
+        result += QTest::qExec(&test, argc, argv);
+    }
 
     qDebug() << "\n=== Test Results ===";
     if (result == 0) {
@@ -0,0 +1,279 @@
+/**
+ * @file test_basemonitor.cpp
+ * @brief Test implementation for BaseMonitor adaptive sampling, tick latency and demand
+ */
+
+#include "test_basemonitor.h"
+#include "model/base/basemonitor.h"
+#include "core/sampleclock.h"
+
+#include <QCoreApplication>
+#include <QSignalSpy>
+#include <QThread>
+
+namespace {
+
+// Monitor reporting a scripted metric, sampled by hand
+class ScriptedMonitor : public BaseMonitor
+{
+public:
+    ScriptedMonitor() : value(0.0), collectDelayUs(0), busyUs(0), collects(0)
+    {
+        setExternallyScheduled(true);
+        setUpdateInterval(1000);
+    }
+
+    void feed(double next)
+    {
+        value = next;
+        sample();
+    }
+
+    double value;
+    unsigned long collectDelayUs;
+    qint64 busyUs;              // On-CPU work per collect (sleeping costs no CPU)
+    int collects;
+
+protected:
+    void collectData() override
+    {
+        ++collects;
+        if (collectDelayUs > 0) QThread::usleep(collectDelayUs);
+
+        const qint64 busyUntil = SampleClock::threadCpuNs() + busyUs * 1000;
+        while (SampleClock::threadCpuNs() < busyUntil) {}
+    }
+    void processData() override {}
+    void validateData() override {}
+    void emitSignal() override {}
+
+    bool adaptiveMetric(double* current, double* threshold) const override
+    {
+        *current = value;
+        *threshold = 75.0;
+        return true;
+    }
+
+    qint64 memoryFootprint() const override { return 4096; }
+};
+
+AdaptiveSamplingPolicy enabledPolicy()
+{
+    AdaptiveSamplingPolicy policy;
+    policy.enabled = true;
+    policy.minIntervalMs = 100;
+    policy.maxIntervalMs = 8000;
+    policy.calmSamplesToSlowDown = 3;
+    return policy;
+}
+
+} // namespace
+
+void TestBaseMonitor::testSpikeDropsToMinimum()
+{
+    ScriptedMonitor monitor;
+    monitor.setAdaptivePolicy(enabledPolicy());
+    monitor.startMonitoring();
+
+    monitor.feed(20.0);
+    QCOMPARE(monitor.getUpdateInterval(), 1000);
+
+    QSignalSpy changes(&monitor, &BaseMonitor::updateIntervalChanged);
+    monitor.feed(45.0);
+    QCOMPARE(monitor.getUpdateInterval(), 100);
+    QCOMPARE(changes.count(), 1);
+
+    // Close to the threshold keeps the fast rate even without movement
+    monitor.feed(66.0);
+    monitor.feed(66.0);
+    monitor.feed(66.0);
+    monitor.feed(66.0);
+    QCOMPARE(monitor.getUpdateInterval(), 100);
+}
+
+void TestBaseMonitor::testFlatSignalBacksOff()
+{
+    ScriptedMonitor monitor;
+    monitor.setAdaptivePolicy(enabledPolicy());
+    monitor.startMonitoring();
+
+    // Three flat samples per doubling, capped at the maximum
+    const int expected[] = {1000, 1000, 2000, 2000, 2000, 4000, 4000, 4000, 8000, 8000, 8000, 8000};
+    for (int step : expected) {
+        monitor.feed(10.0);
+        QCOMPARE(monitor.getUpdateInterval(), step);
+    }
+    QCOMPARE(monitor.getConfiguredInterval(), 1000);
+}
+
+void TestBaseMonitor::testHysteresisBandHoldsRate()
+{
+    ScriptedMonitor monitor;
+    monitor.setAdaptivePolicy(enabledPolicy());
+    monitor.startMonitoring();
+
+    // 5% steps sit between calmDelta (2) and volatileDelta (10)
+    double value = 10.0;
+    for (int i = 0; i < 8; ++i) {
+        value += (i % 2 == 0) ? 5.0 : -5.0;
+        monitor.feed(value);
+        QCOMPARE(monitor.getUpdateInterval(), 1000);
+    }
+
+    // A medium step interrupts a calm streak
+    monitor.feed(10.0);
+    monitor.feed(10.0);
+    monitor.feed(15.0);
+    monitor.feed(15.0);
+    monitor.feed(15.0);
+    QCOMPARE(monitor.getUpdateInterval(), 1000);
+}
+
+void TestBaseMonitor::testDisableRestoresConfigured()
+{
+    ScriptedMonitor monitor;
+    monitor.setAdaptivePolicy(enabledPolicy());
+    monitor.startMonitoring();
+
+    monitor.feed(10.0);
+    monitor.feed(60.0);
+    QCOMPARE(monitor.getUpdateInterval(), 100);
+
+    monitor.setAdaptivePolicy(AdaptiveSamplingPolicy());
+    QCOMPARE(monitor.getUpdateInterval(), 1000);
+
+    monitor.feed(10.0);
+    monitor.feed(60.0);
+    QCOMPARE(monitor.getUpdateInterval(), 1000);
+}
+
+void TestBaseMonitor::testPhaseLatencyRecorded()
+{
+    ScriptedMonitor monitor;
+    monitor.setLatencyDumpInterval(0);
+    monitor.startMonitoring();
+
+    monitor.collectDelayUs = 2000;
+    for (int i = 0; i < 5; ++i) {
+        monitor.feed(10.0);
+    }
+
+    const TickLatencyStats stats = monitor.getLatencyStats();
+    const TickLatencyStats::PhaseLatency& collect = stats.phases[TickLatencyStats::Collect];
+    const TickLatencyStats::PhaseLatency& total = stats.phases[TickLatencyStats::Total];
+
+    QCOMPARE(collect.count, quint64(5));
+    QVERIFY(collect.p50Ns >= 2000000);
+    QVERIFY(collect.p99Ns <= collect.maxNs);
+    QVERIFY(total.maxNs >= collect.maxNs);
+    QVERIFY(stats.phases[TickLatencyStats::Emit].maxNs < collect.p50Ns);
+
+    monitor.resetLatencyStats();
+    QCOMPARE(monitor.getLatencyStats().phases[TickLatencyStats::Total].count, quint64(0));
+}
+
+void TestBaseMonitor::testMissedDeadlines()
+{
+    ScriptedMonitor monitor;
+    monitor.setLatencyDumpInterval(0);
+    monitor.setUpdateInterval(100);
+    monitor.startMonitoring();
+
+    monitor.feed(10.0);
+    QTest::qWait(100);
+    monitor.feed(10.0);
+    QCOMPARE(monitor.getLatencyStats().missedDeadlines, quint64(0));
+
+    // Three and a half periods late: at least two samples were skipped
+    QTest::qWait(350);
+    monitor.feed(10.0);
+    QVERIFY(monitor.getLatencyStats().missedDeadlines >= 2);
+
+    // A pause is not a miss
+    const quint64 missed = monitor.getLatencyStats().missedDeadlines;
+    monitor.pauseMonitoring();
+    QTest::qWait(300);
+    monitor.resumeMonitoring();
+    monitor.feed(10.0);
+    QCOMPARE(monitor.getLatencyStats().missedDeadlines, missed);
+}
+
+void TestBaseMonitor::testDemandParking()
+{
+    ScriptedMonitor monitor;
+    monitor.startMonitoring();
+    monitor.setDemandDriven(true);
+    QCoreApplication::processEvents();
+    QVERIFY(monitor.isParked());
+
+    monitor.feed(10.0);
+    QCOMPARE(monitor.collects, 0);
+
+    // First subscriber: unpark with one warm-up collect
+    MonitorSubscription subscription = monitor.subscribe();
+    QCoreApplication::processEvents();
+    QVERIFY(!monitor.isParked());
+    QCOMPARE(monitor.collects, 1);
+    monitor.feed(10.0);
+    QCOMPARE(monitor.collects, 2);
+
+    subscription.release();
+    QCoreApplication::processEvents();
+    QVERIFY(monitor.isParked());
+
+    // A data signal connection is demand too, lifecycle signals are not
+    QObject consumer;
+    connect(&monitor, &BaseMonitor::updateIntervalChanged, &consumer, [] {});
+    QCoreApplication::processEvents();
+    QVERIFY(monitor.isParked());
+
+    const QMetaObject::Connection connection =
+        connect(&monitor, &BaseMonitor::dataUpdated, &consumer, [] {});
+    QCoreApplication::processEvents();
+    QCOMPARE(monitor.subscriberCount(), 1);
+    QVERIFY(!monitor.isParked());
+
+    disconnect(connection);
+    QCoreApplication::processEvents();
+    QVERIFY(monitor.isParked());
+
+    // Connections marked as owner plumbing do not keep it awake
+    connect(&monitor, &BaseMonitor::dataUpdated, &consumer, [] {});
+    monitor.markOwnerConnections();
+    QCoreApplication::processEvents();
+    QCOMPARE(monitor.subscriberCount(), 0);
+    QVERIFY(monitor.isParked());
+}
+
+void TestBaseMonitor::testCpuBudgetLengthensInterval()
+{
+    ScriptedMonitor monitor;
+    monitor.setUpdateInterval(100);
+    monitor.startMonitoring();
+
+    monitor.busyUs = 2000;
+    monitor.feed(10.0);
+    MonitorOverhead overhead = monitor.getOverhead();
+    QCOMPARE(overhead.ticks, quint64(1));
+    QVERIFY(overhead.cpuTimeNs >= 2000000);
+    QCOMPARE(overhead.memoryBytes, qint64(4096));
+    QCOMPARE(overhead.budgetIntervalMs, 0);
+    QCOMPARE(monitor.getUpdateInterval(), 100);
+
+    // 2ms per tick within 1% of a core needs at least 200ms
+    monitor.setCpuBudget(1.0);
+    monitor.feed(10.0);
+    overhead = monitor.getOverhead();
+    QVERIFY(overhead.budgetIntervalMs >= 200);
+    QCOMPARE(monitor.getUpdateInterval(), overhead.budgetIntervalMs);
+    QVERIFY(overhead.cpuPercent <= 1.0);
+    QCOMPARE(monitor.getConfiguredInterval(), 100);
+
+    // Cheap again: the smoothed cost decays back to the configured rate
+    monitor.busyUs = 0;
+    for (int i = 0; i < 60 && monitor.getUpdateInterval() != 100; ++i) {
+        monitor.feed(10.0);
+    }
+    QCOMPARE(monitor.getUpdateInterval(), 100);
+    QVERIFY(monitor.getOverhead().budgetIntervalMs <= 100);
+}
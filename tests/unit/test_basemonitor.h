@@ -0,0 +1,27 @@
+/**
+ * @file test_basemonitor.h
+ * @brief Tests for BaseMonitor adaptive sampling, tick latency and demand
+ */
+
+#ifndef TEST_BASEMONITOR_H
+#define TEST_BASEMONITOR_H
+
+#include <QObject>
+#include <QTest>
+
+class TestBaseMonitor : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testSpikeDropsToMinimum();
+    void testFlatSignalBacksOff();
+    void testHysteresisBandHoldsRate();
+    void testDisableRestoresConfigured();
+    void testPhaseLatencyRecorded();
+    void testMissedDeadlines();
+    void testDemandParking();
+    void testCpuBudgetLengthensInterval();
+};
+
+#endif // TEST_BASEMONITOR_H
@@ -0,0 +1,74 @@
+/**
+ * @file test_coalescingmailbox.cpp
+ * @brief Test implementation for CoalescingMailbox
+ */
+
+#include "test_coalescingmailbox.h"
+#include "model/base/coalescingmailbox.h"
+
+#include <QCoreApplication>
+#include <QVector>
+#include <atomic>
+#include <thread>
+
+void TestCoalescingMailbox::testStalledConsumerGetsLatest()
+{
+    QVector<int> received;
+    CoalescingMailbox<int> mailbox([&received](const int& value) { received.append(value); });
+
+    // Consumer stalled: 1000 posts, no event processing
+    for (int i = 1; i <= 1000; ++i) {
+        mailbox.post(i);
+    }
+    QCOMPARE(mailbox.droppedCount(), quint64(999));
+
+    QCoreApplication::processEvents();
+    QCOMPARE(received.size(), 1);
+    QCOMPARE(received.first(), 1000);
+    QCOMPARE(mailbox.postedCount(), quint64(1000));
+    QCOMPARE(mailbox.deliveredCount(), quint64(1));
+}
+
+void TestCoalescingMailbox::testEveryValueDeliveredWhenKeepingUp()
+{
+    QVector<int> received;
+    CoalescingMailbox<int> mailbox([&received](const int& value) { received.append(value); });
+
+    for (int i = 1; i <= 5; ++i) {
+        mailbox.post(i);
+        QCoreApplication::processEvents();
+    }
+
+    QCOMPARE(received, QVector<int>({1, 2, 3, 4, 5}));
+    QCOMPARE(mailbox.droppedCount(), quint64(0));
+}
+
+void TestCoalescingMailbox::testCrossThreadProducer()
+{
+    int last = 0;
+    bool ordered = true;
+    CoalescingMailbox<int> mailbox([&](const int& value) {
+        ordered = ordered && value > last;
+        last = value;
+    });
+
+    std::atomic<bool> done(false);
+    std::thread producer([&] {
+        for (int i = 1; i <= 20000; ++i) {
+            mailbox.post(i);
+        }
+        done = true;
+    });
+
+    while (!done) {
+        QCoreApplication::processEvents();
+    }
+    producer.join();
+    QCoreApplication::processEvents();
+
+    // Never out of order, always ends on the newest value, nothing lost
+    // that was not superseded
+    QVERIFY(ordered);
+    QCOMPARE(last, 20000);
+    QCOMPARE(mailbox.deliveredCount() + mailbox.droppedCount(), quint64(20000));
+}
@@ -0,0 +1,22 @@
+/**
+ * @file test_coalescingmailbox.h
+ * @brief Tests for latest-value-wins cross-thread delivery
+ */
+
+#ifndef TEST_COALESCINGMAILBOX_H
+#define TEST_COALESCINGMAILBOX_H
+
+#include <QObject>
+#include <QTest>
+
+class TestCoalescingMailbox : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testStalledConsumerGetsLatest();
+    void testEveryValueDeliveredWhenKeepingUp();
+    void testCrossThreadProducer();
+};
+
+#endif // TEST_COALESCINGMAILBOX_H
@@ -0,0 +1,98 @@
+/**
+ * @file test_cpufrequencysampler.cpp
+ * @brief CPUFrequencySampler unit tests implementation
+ *
+ * The sampler reads a temporary tree in /sys/devices/system/cpu
+ * layout, rewritten in place between samples.
+ */
+
+#include "test_cpufrequencysampler.h"
+#include "core/cpufrequencysampler.h"
+#include "testhelpers.h"
+
+#include <QDir>
+#include <QTemporaryDir>
+
+namespace {
+
+bool writeFrequency(const QString& cpuRoot, int cpu, const QByteArray& kHz)
+{
+    const QString dir = QString("%1/cpu%2/cpufreq").arg(cpuRoot).arg(cpu);
+    return QDir().mkpath(dir) && writeFile(dir + "/scaling_cur_freq", kHz + "\n");
+}
+
+} // namespace
+
+void TestCPUFrequencySampler::testMissingCpufreq()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString cpuRoot = dir.filePath("cpu");
+
+    // VM or fixed-clock board: CPU directories without cpufreq
+    QVERIFY(QDir().mkpath(cpuRoot + "/cpu0"));
+    QVERIFY(QDir().mkpath(cpuRoot + "/cpu1"));
+
+    CPUFrequencySampler sampler;
+    QCOMPARE(sampler.discover(2, cpuRoot), 0);
+    QCOMPARE(sampler.sample(), 0);
+    QCOMPARE(sampler.frequencies(), QVector<double>({0.0, 0.0}));
+    QCOMPARE(sampler.averageFrequency(), 0.0);
+    QCOMPARE(sampler.availableCount(), 0);
+
+    // No CPU root at all
+    QCOMPARE(sampler.discover(2, dir.filePath("missing")), 0);
+    QCOMPARE(sampler.sample(), 0);
+    QCOMPARE(sampler.frequencies().size(), 2);
+}
+
+void TestCPUFrequencySampler::testOfflineCPUs()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString cpuRoot = dir.filePath("cpu");
+
+    // cpu1 and cpu3 are offline: their cpufreq directory is gone
+    QVERIFY(writeFrequency(cpuRoot, 0, "1200000"));
+    QVERIFY(QDir().mkpath(cpuRoot + "/cpu1"));
+    QVERIFY(writeFrequency(cpuRoot, 2, "1800000"));
+
+    CPUFrequencySampler sampler;
+    QCOMPARE(sampler.discover(4, cpuRoot), 2);
+    QCOMPARE(sampler.sample(), 2);
+    QCOMPARE(sampler.frequencies(), QVector<double>({1200.0, 0.0, 1800.0, 0.0}));
+    QCOMPARE(sampler.averageFrequency(), 1500.0);
+    QCOMPARE(sampler.availableCount(), 2);
+
+    // Onlined CPUs are picked up by the next discover()
+    QVERIFY(writeFrequency(cpuRoot, 1, "600000"));
+    QVERIFY(writeFrequency(cpuRoot, 3, "2400000"));
+    QCOMPARE(sampler.sample(), 2);
+    QCOMPARE(sampler.discover(4, cpuRoot), 4);
+    QCOMPARE(sampler.sample(), 4);
+    QCOMPARE(sampler.averageFrequency(), 1500.0);
+}
+
+void TestCPUFrequencySampler::testAverageSkipsZero()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString cpuRoot = dir.filePath("cpu");
+    QVERIFY(writeFrequency(cpuRoot, 0, "1000000"));
+    QVERIFY(writeFrequency(cpuRoot, 1, "0"));
+    QVERIFY(writeFrequency(cpuRoot, 2, "2000000"));
+
+    // A zero reading counts as no reading, not as a 0 MHz core
+    CPUFrequencySampler sampler;
+    QCOMPARE(sampler.discover(3, cpuRoot), 3);
+    QCOMPARE(sampler.sample(), 2);
+    QCOMPARE(sampler.frequencies(), QVector<double>({1000.0, 0.0, 2000.0}));
+    QCOMPARE(sampler.averageFrequency(), 1500.0);
+    QCOMPARE(sampler.availableCount(), 2);
+
+    // Same for an unparsable value
+    QVERIFY(writeFile(cpuRoot + "/cpu2/cpufreq/scaling_cur_freq", "<unknown>\n"));
+    QCOMPARE(sampler.sample(), 1);
+    QCOMPARE(sampler.averageFrequency(), 1000.0);
+    QCOMPARE(sampler.frequencies().at(2), 0.0);
+}
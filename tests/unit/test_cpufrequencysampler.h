@@ -0,0 +1,22 @@
+/**
+ * @file test_cpufrequencysampler.h
+ * @brief CPUFrequencySampler unit tests
+ */
+
+#ifndef TEST_CPUFREQUENCYSAMPLER_H
+#define TEST_CPUFREQUENCYSAMPLER_H
+
+#include <QObject>
+#include <QTest>
+
+class TestCPUFrequencySampler : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testMissingCpufreq();
+    void testOfflineCPUs();
+    void testAverageSkipsZero();
+};
+
+#endif // TEST_CPUFREQUENCYSAMPLER_H
@@ -0,0 +1,144 @@
+/**
+ * @file test_cpukernels.cpp
+ * @brief Test implementation for CPUKernels
+ */
+
+#include "test_cpukernels.h"
+#include "core/cpukernels.h"
+
+#include <QRandomGenerator>
+#include <cmath>
+
+Q_DECLARE_METATYPE(CPUKernels::Backend)
+
+namespace {
+
+// Two synthetic samples one second (100 jiffies) apart
+void makeSamples(int coreCount, CPUStatArrays& previous, CPUStatArrays& current)
+{
+    previous.resize(coreCount);
+    current.resize(coreCount);
+
+    QRandomGenerator random(42);
+    for (int field = 0; field < CPUStatArrays::FieldCount; ++field) {
+        for (int i = 0; i < coreCount; ++i) {
+            const quint64 base = random.bounded(1u << 30);
+            previous.column(field)[i] = base;
+            current.column(field)[i] = base + random.bounded(100u);
+        }
+    }
+
+    // Counter reset on one core: negative delta must clamp to 0
+    if (coreCount > 1) {
+        current.column(CPUStatArrays::System)[1] = 0;
+    }
+}
+
+void addBackendRows(int coreCount)
+{
+    const CPUKernels::Backend backends[] = {
+        CPUKernels::Backend::Scalar, CPUKernels::Backend::SSE2,
+        CPUKernels::Backend::AVX2, CPUKernels::Backend::NEON
+    };
+    for (CPUKernels::Backend backend : backends) {
+        if (!CPUKernels::isSupported(backend)) continue;
+        const QByteArray name = QByteArray::number(coreCount) +
+                                " cores " + CPUKernels::backendName(backend);
+        QTest::newRow(name.constData()) << backend << coreCount;
+    }
+}
+
+} // namespace
+
+// Correctness tests
+void TestCPUKernels::testKnownValues()
+{
+    CPUStatArrays previous;
+    CPUStatArrays current;
+    previous.resize(2);
+    current.resize(2);
+
+    // Core 0: 60 user + 10 system + 20 idle + 10 steal jiffies
+    current.column(CPUStatArrays::User)[0] = 60;
+    current.column(CPUStatArrays::System)[0] = 10;
+    current.column(CPUStatArrays::Idle)[0] = 20;
+    current.column(CPUStatArrays::Steal)[0] = 10;
+    // Core 1: no time elapsed
+
+    CPUDeltaArrays output;
+    CPUKernels::computeCoreDeltas(current, previous, output);
+
+    QCOMPARE(output.count(), 2);
+    QCOMPARE(output.usage()[0], 80.0);
+    QCOMPARE(output.percent(CPUStatArrays::User)[0], 60.0);
+    QCOMPARE(output.percent(CPUStatArrays::System)[0], 10.0);
+    QCOMPARE(output.percent(CPUStatArrays::Idle)[0], 20.0);
+    QCOMPARE(output.percent(CPUStatArrays::Steal)[0], 10.0);
+    QCOMPARE(output.usage()[1], 0.0);
+    QCOMPARE(output.percent(CPUStatArrays::Idle)[1], 0.0);
+}
+
+void TestCPUKernels::testBackendsMatchScalar_data()
+{
+    QTest::addColumn<CPUKernels::Backend>("backend");
+    QTest::addColumn<int>("coreCount");
+
+    for (int coreCount : {1, 3, 4, 64, 257}) {
+        addBackendRows(coreCount);
+    }
+}
+
+void TestCPUKernels::testBackendsMatchScalar()
+{
+    QFETCH(CPUKernels::Backend, backend);
+    QFETCH(int, coreCount);
+
+    CPUStatArrays previous;
+    CPUStatArrays current;
+    makeSamples(coreCount, previous, current);
+
+    CPUDeltaArrays expected;
+    CPUDeltaArrays actual;
+    CPUKernels::computeCoreDeltas(CPUKernels::Backend::Scalar, current, previous, expected);
+    CPUKernels::computeCoreDeltas(backend, current, previous, actual);
+
+    for (int i = 0; i < coreCount; ++i) {
+        QVERIFY(actual.usage()[i] >= 0.0 && actual.usage()[i] <= 100.0);
+        QVERIFY(std::fabs(actual.usage()[i] - expected.usage()[i]) < 1e-9);
+        for (int field = 0; field < CPUStatArrays::FieldCount; ++field) {
+            QVERIFY(std::fabs(actual.percent(field)[i] - expected.percent(field)[i]) < 1e-9);
+        }
+    }
+
+    if (coreCount > 1) {
+        QCOMPARE(actual.percent(CPUStatArrays::System)[1], 0.0);
+    }
+}
+
+// Performance tests
+void TestCPUKernels::benchmarkCoreDeltas_data()
+{
+    QTest::addColumn<CPUKernels::Backend>("backend");
+    QTest::addColumn<int>("coreCount");
+
+    for (int coreCount : {4, 64, 256, 1024}) {
+        addBackendRows(coreCount);
+    }
+}
+
+void TestCPUKernels::benchmarkCoreDeltas()
+{
+    QFETCH(CPUKernels::Backend, backend);
+    QFETCH(int, coreCount);
+
+    CPUStatArrays previous;
+    CPUStatArrays current;
+    makeSamples(coreCount, previous, current);
+
+    CPUDeltaArrays output;
+    output.resize(current.count(), current.stride());
+
+    QBENCHMARK {
+        CPUKernels::computeCoreDeltas(backend, current, previous, output);
+    }
+}
@@ -0,0 +1,27 @@
+/**
+ * @file test_cpukernels.h
+ * @brief Tests and benchmarks for the per-core CPU delta kernels
+ */
+
+#ifndef TEST_CPUKERNELS_H
+#define TEST_CPUKERNELS_H
+
+#include <QObject>
+#include <QTest>
+
+class TestCPUKernels : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Correctness tests
+    void testKnownValues();
+    void testBackendsMatchScalar_data();
+    void testBackendsMatchScalar();
+
+    // Performance tests
+    void benchmarkCoreDeltas_data();
+    void benchmarkCoreDeltas();
+};
+
+#endif // TEST_CPUKERNELS_H
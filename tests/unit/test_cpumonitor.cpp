@@ -6,6 +6,9 @@
 #include "test_cpumonitor.h"
 #include "core/systemutils.h"
 #include "core/constants.h"
+#include "testhelpers.h"
+
+#include <QTemporaryDir>
 
 void TestCPUMonitor::initTestCase()
 {
@@ -127,6 +130,79 @@ void TestCPUMonitor::testUsageCalculation()
     }
 }
 
+void TestCPUMonitor::testFailedStatReadKeepsUsage()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString statPath = dir.filePath("stat");
+    QVERIFY(writeFile(statPath, "cpu  100 0 100 800 0 0 0 0\ncpu0 100 0 100 800 0 0 0 0\n"));
+
+    m_monitor->setStatPath(statPath);
+    m_monitor->setExternallyScheduled(true);
+    m_monitor->startMonitoring();
+    m_monitor->sample();
+
+    // 300 user, 500 idle ticks
+    QVERIFY(writeFile(statPath, "cpu  400 0 100 1300 0 0 0 0\ncpu0 400 0 100 1300 0 0 0 0\n"));
+    m_monitor->sample();
+    const CPUData second = m_monitor->getCurrentData();
+    QCOMPARE(second.totalUsage, 37.5);
+    QVERIFY(second.cores.at(0).usage > 0.0);
+
+    // Nothing read: the last figures stand, no delta across stale buffers
+    QVERIFY(writeFile(statPath, QByteArray()));
+    m_monitor->sample();
+    const CPUData failed = m_monitor->getCurrentData();
+    QCOMPARE(failed.totalUsage, second.totalUsage);
+    QCOMPARE(failed.cores.at(0).usage, second.cores.at(0).usage);
+
+    // The next read is compared to the last good one
+    QVERIFY(writeFile(statPath, "cpu  500 0 100 1400 0 0 0 0\ncpu0 500 0 100 1400 0 0 0 0\n"));
+    m_monitor->sample();
+    QCOMPARE(m_monitor->getCurrentData().totalUsage, 50.0);
+}
+
+void TestCPUMonitor::testBreakdownFromStat()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString statPath = dir.filePath("stat");
+    QVERIFY(writeFile(statPath, "cpu  1000 100 500 8000 200 50 50 0 0 0\n"
+                                "cpu0 1000 100 500 8000 200 50 50 0 0 0\n"));
+
+    m_monitor->setStatPath(statPath);
+    m_monitor->setExternallyScheduled(true);
+    m_monitor->startMonitoring();
+    m_monitor->sample();
+
+    // 200 ticks: 50 user, 10 nice, 30 system, 80 idle, 10 iowait,
+    // 6 irq, 4 softirq, 10 steal
+    QVERIFY(writeFile(statPath, "cpu  1050 110 530 8080 210 56 54 10 0 0\n"
+                                "cpu0 1050 110 530 8080 210 56 54 10 0 0\n"));
+    m_monitor->sample();
+
+    const CPUData data = m_monitor->getCurrentData();
+    const CPUTimeBreakdown& total = data.breakdown;
+    QCOMPARE(total.user, 25.0);
+    QCOMPARE(total.nice, 5.0);
+    QCOMPARE(total.system, 15.0);
+    QCOMPARE(total.idle, 40.0);
+    QCOMPARE(total.iowait, 5.0);
+    QCOMPARE(total.irq, 3.0);
+    QCOMPARE(total.softirq, 2.0);
+    QCOMPARE(total.steal, 5.0);
+    QCOMPARE(total.user + total.nice + total.system + total.idle + total.iowait +
+             total.irq + total.softirq + total.steal, 100.0);
+    QCOMPARE(data.totalUsage, 60.0);
+
+    // The per-core split comes from the vector kernel, same figures
+    const CPUTimeBreakdown& core = data.cores.at(0).breakdown;
+    QCOMPARE(core.user, total.user);
+    QCOMPARE(core.idle, total.idle);
+    QCOMPARE(core.steal, total.steal);
+    QCOMPARE(data.cores.at(0).usage, 60.0);
+}
+
 void TestCPUMonitor::testTemperatureReading()
 {
     // Test temperature reading
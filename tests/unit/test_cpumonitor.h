@@ -30,6 +30,8 @@ private slots:
 
     // CPU specific tests
     void testUsageCalculation();
+    void testFailedStatReadKeepsUsage();
+    void testBreakdownFromStat();
     void testTemperatureReading();
     void testCoreDataCollection();
 
@@ -0,0 +1,59 @@
+/**
+ * @file test_latencyhistogram.cpp
+ * @brief Test implementation for LatencyHistogram
+ */
+
+#include "test_latencyhistogram.h"
+#include "core/latencyhistogram.h"
+
+void TestLatencyHistogram::testBucketMapping()
+{
+    // Exact below 16, then contiguous buckets with bounded width
+    for (qint64 value = 0; value < 16; ++value) {
+        QCOMPARE(LatencyHistogram::bucketIndex(value), int(value));
+    }
+
+    int previous = LatencyHistogram::bucketIndex(15);
+    for (qint64 value = 16; value < (1LL << 18); ++value) {
+        const int index = LatencyHistogram::bucketIndex(value);
+        QVERIFY(index >= previous && index <= previous + 1);
+        QVERIFY(value <= LatencyHistogram::bucketUpperBound(index));
+        QVERIFY(LatencyHistogram::bucketUpperBound(index) - value <= value / 16);
+        previous = index;
+    }
+
+    QCOMPARE(LatencyHistogram::bucketIndex(-5), 0);
+    QCOMPARE(LatencyHistogram::bucketIndex(1LL << 50), LatencyHistogram::BUCKET_COUNT - 1);
+}
+
+void TestLatencyHistogram::testPercentiles()
+{
+    LatencyHistogram histogram;
+
+    // 1..1000 us
+    for (qint64 us = 1; us <= 1000; ++us) {
+        histogram.record(us * 1000);
+    }
+
+    QCOMPARE(histogram.count(), quint64(1000));
+    QCOMPARE(histogram.max(), qint64(1000000));
+
+    const qint64 p50 = histogram.percentile(50.0);
+    const qint64 p99 = histogram.percentile(99.0);
+    QVERIFY(p50 >= 500000 && p50 <= 500000 * 17 / 16);
+    QVERIFY(p99 >= 990000 && p99 <= 1000000);
+    QCOMPARE(histogram.percentile(100.0), qint64(1000000));
+}
+
+void TestLatencyHistogram::testEmptyAndReset()
+{
+    LatencyHistogram histogram;
+    QCOMPARE(histogram.percentile(99.0), qint64(0));
+
+    histogram.record(123456);
+    QCOMPARE(histogram.percentile(50.0), qint64(123456));
+
+    histogram.reset();
+    QCOMPARE(histogram.count(), quint64(0));
+    QCOMPARE(histogram.max(), qint64(0));
+}
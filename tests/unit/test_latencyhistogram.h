@@ -0,0 +1,22 @@
+/**
+ * @file test_latencyhistogram.h
+ * @brief Tests for the log-linear latency histogram
+ */
+
+#ifndef TEST_LATENCYHISTOGRAM_H
+#define TEST_LATENCYHISTOGRAM_H
+
+#include <QObject>
+#include <QTest>
+
+class TestLatencyHistogram : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testBucketMapping();
+    void testPercentiles();
+    void testEmptyAndReset();
+};
+
+#endif // TEST_LATENCYHISTOGRAM_H
@@ -0,0 +1,211 @@
+/**
+ * @file test_networkmonitor.cpp
+ * @brief NetworkMonitor unit tests implementation
+ *
+ * The monitor reads a temporary file in /proc/net/dev format, rewritten
+ * in place between samples.
+ */
+
+#include "test_networkmonitor.h"
+#include "model/monitors/networkmonitor.h"
+#include "testhelpers.h"
+
+#include <QTemporaryDir>
+
+namespace {
+
+const char NET_DEV_HEADER[] =
+    "Inter-|   Receive                                                |  Transmit\n"
+    " face |bytes    packets errs drop fifo frame compressed multicast|bytes    packets errs drop fifo colls carrier compressed\n";
+
+struct Counters {
+    const char* name;
+    quint64 rxBytes;
+    quint64 rxPackets;
+    quint64 txBytes;
+    quint64 txPackets;
+    quint64 rxErrors;
+    quint64 txDrops;
+};
+
+bool writeNetDev(const QString& path, std::initializer_list<Counters> interfaces)
+{
+    QByteArray content = NET_DEV_HEADER;
+    for (const Counters& c : interfaces) {
+        content += QByteArray(c.name) + ": " +
+                   QByteArray::number(c.rxBytes) + ' ' + QByteArray::number(c.rxPackets) + ' ' +
+                   QByteArray::number(c.rxErrors) + " 0 0 0 0 0 " +
+                   QByteArray::number(c.txBytes) + ' ' + QByteArray::number(c.txPackets) +
+                   " 0 " + QByteArray::number(c.txDrops) + " 0 0 0 0\n";
+    }
+    return writeFile(path, content);
+}
+
+const NetworkInterfaceData* findInterface(const NetworkData& data, const QString& name)
+{
+    for (const NetworkInterfaceData& entry : data.interfaces) {
+        if (entry.name == name) return &entry;
+    }
+    return nullptr;
+}
+
+} // namespace
+
+void TestNetworkMonitor::testRatesFromCounters()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString path = dir.filePath("dev");
+    QVERIFY(writeNetDev(path, {{"lo", 5000, 50, 5000, 50, 0, 0},
+                               {"eth0", 1000, 10, 2000, 20, 0, 0}}));
+
+    NetworkMonitor monitor;
+    monitor.setNetDevPath(path);
+    monitor.setExternallyScheduled(true);
+    monitor.startMonitoring();
+
+    // First sample has no previous counters: no rates yet
+    monitor.sample();
+    const NetworkData first = monitor.getCurrentData();
+    QCOMPARE(first.interfaces.size(), 2);
+    QCOMPARE(first.totalDownloadSpeed, 0.0);
+    QCOMPARE(first.activeInterface, QString("eth0"));
+
+    QTest::qWait(20);
+    QVERIFY(writeNetDev(path, {{"lo", 9000, 90, 9000, 90, 0, 0},
+                               {"eth0", 501000, 510, 102000, 120, 4, 2}}));
+    monitor.sample();
+    const NetworkData second = monitor.getCurrentData();
+
+    // Rates divide by the real time between the two reads
+    const double perSecond = 1e9 / (second.timestampNs - first.timestampNs);
+    const NetworkInterfaceData* eth0 = findInterface(second, "eth0");
+    QVERIFY(eth0);
+    QCOMPARE(eth0->bytesReceived, qint64(501000));
+    QCOMPARE(eth0->downloadSpeed, 500000 * perSecond);
+    QCOMPARE(eth0->uploadSpeed, 100000 * perSecond);
+    QCOMPARE(eth0->packetReceiveRate, 500 * perSecond);
+    QCOMPARE(eth0->packetSendRate, 100 * perSecond);
+    QCOMPARE(eth0->receiveErrorRate, 4 * perSecond);
+    QCOMPARE(eth0->sendDropRate, 2 * perSecond);
+    QVERIFY(eth0->isActive);
+
+    // Loopback traffic is not network traffic
+    QCOMPARE(second.totalDownloadSpeed, eth0->downloadSpeed);
+    QCOMPARE(second.totalErrorRate, eth0->receiveErrorRate);
+    QCOMPARE(second.totalDropRate, eth0->sendDropRate);
+    QCOMPARE(second.activeInterface, QString("eth0"));
+    QCOMPARE(monitor.getHistory().size(), 2);
+    QVERIFY(monitor.getHistory().last().interfaces.isEmpty());
+
+    // A failed read reports no rates instead of repeating the last ones
+    QVERIFY(writeFile(path, QByteArray()));
+    monitor.sample();
+    const NetworkData third = monitor.getCurrentData();
+    QCOMPARE(third.totalDownloadSpeed, 0.0);
+    QCOMPARE(third.totalUploadSpeed, 0.0);
+}
+
+void TestNetworkMonitor::testCounterWrapAndReset()
+{
+    // 32-bit unsigned long wrapped
+    QCOMPARE(ProcParser::counterDelta(4294967000ULL, 100, false), quint64(396));
+    QCOMPARE(ProcParser::counterDelta(100, 400, false), quint64(300));
+
+    // Counter started over: no delta, not a huge one
+    QCOMPARE(ProcParser::counterDelta(3000000, 1000, false), quint64(0));
+    QCOMPARE(ProcParser::counterDelta(4294967000ULL, 100, true), quint64(0));
+    QCOMPARE(ProcParser::counterDelta(10000000000ULL, 100, false), quint64(0));
+
+    // 64-bit kernel: a veth re-created under the same name, its old
+    // counter between 2^31 and 2^32, is a reset
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString path = dir.filePath("dev");
+    QVERIFY(writeNetDev(path, {{"veth0", 3000000000ULL, 10, 4000000000ULL, 20, 0, 0}}));
+
+    NetworkMonitor monitor;
+    monitor.setNetDevPath(path);
+    monitor.setWideCounters(true);
+    monitor.setExternallyScheduled(true);
+    monitor.startMonitoring();
+    monitor.sample();
+
+    QTest::qWait(20);
+    QVERIFY(writeNetDev(path, {{"veth0", 1000, 1, 500, 1, 0, 0}}));
+    monitor.sample();
+    const NetworkData data = monitor.getCurrentData();
+    QCOMPARE(data.totalDownloadSpeed, 0.0);
+    QCOMPARE(data.totalUploadSpeed, 0.0);
+}
+
+void TestNetworkMonitor::testInterfaceChurn()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString path = dir.filePath("dev");
+    QVERIFY(writeNetDev(path, {{"eth0", 1000, 10, 1000, 10, 0, 0},
+                               {"veth1", 2000, 20, 2000, 20, 0, 0},
+                               {"veth2", 3000, 30, 3000, 30, 0, 0}}));
+
+    NetworkMonitor monitor;
+    monitor.setNetDevPath(path);
+    monitor.setExternallyScheduled(true);
+    monitor.startMonitoring();
+    monitor.sample();
+
+    // veth1 gone, veth3 new, veth2 and eth0 swapped places
+    QTest::qWait(20);
+    QVERIFY(writeNetDev(path, {{"veth2", 3300, 33, 3000, 30, 0, 0},
+                               {"eth0", 1100, 11, 1000, 10, 0, 0},
+                               {"veth3", 900, 9, 900, 9, 0, 0}}));
+    monitor.sample();
+    const NetworkData data = monitor.getCurrentData();
+    QCOMPARE(data.interfaces.size(), 3);
+    QVERIFY(!findInterface(data, "veth1"));
+
+    const NetworkInterfaceData* eth0 = findInterface(data, "eth0");
+    const NetworkInterfaceData* veth2 = findInterface(data, "veth2");
+    const NetworkInterfaceData* veth3 = findInterface(data, "veth3");
+    QVERIFY(eth0 && veth2 && veth3);
+
+    // Matched by name, so the deltas are the interface's own
+    QCOMPARE(veth2->downloadSpeed, 3 * eth0->downloadSpeed);
+    QVERIFY(eth0->downloadSpeed > 0.0);
+    QCOMPARE(eth0->uploadSpeed, 0.0);
+
+    // A new interface starts from its second sample
+    QCOMPARE(veth3->downloadSpeed, 0.0);
+    QVERIFY(!veth3->isActive);
+    QCOMPARE(data.activeInterface, QString("veth2"));
+}
+
+void TestNetworkMonitor::testCounterWrapRate()
+{
+    // unsigned long net_device_stats on a 32-bit kernel wrap at 2^32
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString path = dir.filePath("dev");
+    QVERIFY(writeNetDev(path, {{"eth0", 4294967000ULL, 10, 4294966296ULL, 20, 0, 0}}));
+
+    NetworkMonitor monitor;
+    monitor.setNetDevPath(path);
+    monitor.setWideCounters(false);
+    monitor.setExternallyScheduled(true);
+    monitor.startMonitoring();
+    monitor.sample();
+    const NetworkData first = monitor.getCurrentData();
+
+    QTest::qWait(20);
+    QVERIFY(writeNetDev(path, {{"eth0", 704, 20, 1000, 30, 0, 0}}));
+    monitor.sample();
+    const NetworkData second = monitor.getCurrentData();
+
+    // 296 + 704 and 1000 + 1000 bytes across the wrap
+    const double perSecond = 1e9 / (second.timestampNs - first.timestampNs);
+    const NetworkInterfaceData* eth0 = findInterface(second, "eth0");
+    QVERIFY(eth0);
+    QCOMPARE(eth0->downloadSpeed, 1000 * perSecond);
+    QCOMPARE(eth0->uploadSpeed, 2000 * perSecond);
+    QCOMPARE(eth0->packetReceiveRate, 10 * perSecond);
+}
@@ -0,0 +1,23 @@
+/**
+ * @file test_networkmonitor.h
+ * @brief NetworkMonitor unit tests
+ */
+
+#ifndef TEST_NETWORKMONITOR_H
+#define TEST_NETWORKMONITOR_H
+
+#include <QObject>
+#include <QTest>
+
+class TestNetworkMonitor : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testRatesFromCounters();
+    void testCounterWrapAndReset();
+    void testCounterWrapRate();
+    void testInterfaceChurn();
+};
+
+#endif // TEST_NETWORKMONITOR_H
@@ -0,0 +1,85 @@
+/**
+ * @file test_pidmap.cpp
+ * @brief PidMap unit tests implementation
+ */
+
+#include "test_pidmap.h"
+#include "core/pidmap.h"
+
+#include <QHash>
+#include <random>
+
+void TestPidMap::testInsertFindRemove()
+{
+    PidMap<int> map(4);
+    QVERIFY(map.isEmpty());
+    QVERIFY(!map.find(1));
+
+    bool inserted = false;
+    map.insert(1, &inserted) = 10;
+    QVERIFY(inserted);
+    map.insert(1, &inserted) += 5;
+    QVERIFY(!inserted);
+    QCOMPARE(*map.find(1), 15);
+
+    // Grows past the initial capacity, consecutive PIDs stay reachable
+    for (qint32 pid = 2; pid <= 1000; ++pid) {
+        map.insert(pid) = pid;
+    }
+    QCOMPARE(map.size(), 1000);
+    QVERIFY(map.capacity() * 3 >= map.size() * 4);
+    QCOMPARE(*map.find(777), 777);
+
+    QVERIFY(map.remove(777));
+    QVERIFY(!map.remove(777));
+    QVERIFY(!map.contains(777));
+    QCOMPARE(map.size(), 999);
+
+    // Odd PIDs go, every even one must still be found
+    QCOMPARE(map.removeIf([](qint32 pid, int) { return pid % 2 != 0; }), 499);
+    for (qint32 pid = 2; pid <= 1000; pid += 2) {
+        QVERIFY(map.contains(pid));
+    }
+    QCOMPARE(map.size(), 500);
+}
+
+void TestPidMap::testChurnMatchesReference()
+{
+    // Process-table-like churn: inserts, exits and sweeps of a bounded
+    // PID range, checked against QHash after every round
+    std::mt19937 random(42);
+    std::uniform_int_distribution<qint32> pids(1, 4096);
+
+    PidMap<qint32> map;
+    QHash<qint32, qint32> reference;
+
+    for (int round = 0; round < 200; ++round) {
+        for (int i = 0; i < 100; ++i) {
+            const qint32 pid = pids(random);
+            map.insert(pid) = round;
+            reference.insert(pid, round);
+        }
+        for (int i = 0; i < 40; ++i) {
+            const qint32 pid = pids(random);
+            QCOMPARE(map.remove(pid), reference.remove(pid) > 0);
+        }
+        if (round % 10 == 9) {
+            const int stale = round - 5;
+            map.removeIf([stale](qint32, qint32 value) { return value < stale; });
+            for (QHash<qint32, qint32>::iterator it = reference.begin(); it != reference.end(); ) {
+                if (it.value() < stale) {
+                    it = reference.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+
+        QCOMPARE(map.size(), reference.size());
+        for (qint32 pid = 1; pid <= 4096; ++pid) {
+            const qint32* value = map.find(pid);
+            QCOMPARE(value != nullptr, reference.contains(pid));
+            if (value) QCOMPARE(*value, reference.value(pid));
+        }
+    }
+}
@@ -0,0 +1,21 @@
+/**
+ * @file test_pidmap.h
+ * @brief PidMap unit tests
+ */
+
+#ifndef TEST_PIDMAP_H
+#define TEST_PIDMAP_H
+
+#include <QObject>
+#include <QTest>
+
+class TestPidMap : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testInsertFindRemove();
+    void testChurnMatchesReference();
+};
+
+#endif // TEST_PIDMAP_H
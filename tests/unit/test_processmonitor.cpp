@@ -0,0 +1,135 @@
+/**
+ * @file test_processmonitor.cpp
+ * @brief ProcessMonitor unit tests implementation
+ *
+ * The monitor scans a temporary directory in /proc layout: one
+ * "<pid>/stat" and "<pid>/statm" per process, rewritten between samples.
+ */
+
+#include "test_processmonitor.h"
+#include "model/monitors/processmonitor.h"
+
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+#include <unistd.h>
+
+namespace {
+
+struct FakeProcess {
+    qint32 pid;
+    const char* comm;
+    char state;
+    quint64 cpuTicks;       // Split evenly into utime and stime
+    qint64 residentPages;
+    quint64 startTime;
+};
+
+bool writeProcess(const QString& root, const FakeProcess& process)
+{
+    const QString directory = root + '/' + QString::number(process.pid);
+    if (!QDir().mkpath(directory)) return false;
+
+    const QByteArray stat =
+        QByteArray::number(process.pid) + " (" + process.comm + ") " + process.state +
+        " 1 " + QByteArray::number(process.pid) + " " + QByteArray::number(process.pid) +
+        " 0 -1 4194560 120 0 0 0 " +
+        QByteArray::number(process.cpuTicks / 2) + ' ' +
+        QByteArray::number(process.cpuTicks - process.cpuTicks / 2) +
+        " 0 0 20 0 3 0 " + QByteArray::number(process.startTime) + " 10485760 " +
+        QByteArray::number(process.residentPages) + " 18446744073709551615 1 1 0 0 0 0 0 0 0\n";
+    const QByteArray statm = "2560 " + QByteArray::number(process.residentPages) + " 7 1 0 100 0\n";
+
+    QFile statFile(directory + "/stat");
+    QFile statmFile(directory + "/statm");
+    if (!statFile.open(QIODevice::WriteOnly | QIODevice::Truncate) ||
+        !statmFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return false;
+    }
+    return statFile.write(stat) == stat.size() && statmFile.write(statm) == statm.size();
+}
+
+} // namespace
+
+void TestProcessMonitor::testCpuFromDeltasAndTopLists()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    QVERIFY(writeProcess(dir.path(), {1, "init", 'S', 500, 300, 5}));
+    QVERIFY(writeProcess(dir.path(), {200, "busy (worker)", 'R', 1000, 100, 40}));
+    QVERIFY(writeProcess(dir.path(), {300, "light", 'S', 1000, 900, 50}));
+    QVERIFY(QDir().mkpath(dir.filePath("self")));   // Not a PID
+
+    ProcessMonitor monitor;
+    monitor.setProcPath(dir.path());
+    monitor.setTopCount(2);
+    monitor.setExternallyScheduled(true);
+    monitor.startMonitoring();
+
+    // First sample has no baseline: memory list only
+    monitor.sample();
+    const ProcessListData first = monitor.getCurrentData();
+    QCOMPARE(first.processCount, 3);
+    QCOMPARE(first.threadCount, 9);
+    QCOMPARE(first.runningCount, 1);
+    QVERIFY(first.topByCpu.isEmpty());
+    QCOMPARE(first.topByMemory.size(), 2);
+    QCOMPARE(first.topByMemory.at(0).pid, 300);
+    QCOMPARE(first.topByMemory.at(1).pid, 1);
+
+    QTest::qWait(20);
+    QVERIFY(writeProcess(dir.path(), {200, "busy (worker)", 'R', 1030, 100, 40}));
+    QVERIFY(writeProcess(dir.path(), {300, "light", 'S', 1010, 900, 50}));
+    monitor.sample();
+    const ProcessListData second = monitor.getCurrentData();
+
+    // Init used no CPU and stays out of the list
+    QCOMPARE(second.topByCpu.size(), 2);
+    const ProcessData& busy = second.topByCpu.at(0);
+    const ProcessData& light = second.topByCpu.at(1);
+    QCOMPARE(busy.pid, 200);
+    QCOMPARE(busy.name, QString("busy (worker)"));
+    QCOMPARE(busy.state, 'R');
+    QCOMPARE(light.pid, 300);
+    QVERIFY(light.cpuUsage > 0.0);
+    QVERIFY(qAbs(busy.cpuUsage / light.cpuUsage - 3.0) < 1e-9);
+    QVERIFY(qAbs(second.totalCpuUsage - busy.cpuUsage - light.cpuUsage) < 1e-9);
+
+    const ProcessData& largest = second.topByMemory.at(0);
+    QCOMPARE(largest.memoryRss, 900 * static_cast<qint64>(sysconf(_SC_PAGESIZE)));
+    QCOMPARE(largest.memoryShared, 7 * static_cast<qint64>(sysconf(_SC_PAGESIZE)));
+}
+
+void TestProcessMonitor::testPidReuseAndExit()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    QVERIFY(writeProcess(dir.path(), {400, "old", 'S', 100, 10, 1000}));
+    QVERIFY(writeProcess(dir.path(), {500, "exiting", 'S', 100, 10, 1000}));
+
+    ProcessMonitor monitor;
+    monitor.setProcPath(dir.path());
+    monitor.setExternallyScheduled(true);
+    monitor.startMonitoring();
+    monitor.sample();
+    QCOMPARE(monitor.getCurrentData().processCount, 2);
+
+    // PID 400 now belongs to a new process with a lower CPU time and a
+    // later start; 500 is gone
+    QTest::qWait(20);
+    QVERIFY(writeProcess(dir.path(), {400, "new", 'S', 5000, 10, 9000}));
+    QVERIFY(QDir(dir.filePath("500")).removeRecursively());
+    monitor.sample();
+
+    const ProcessListData data = monitor.getCurrentData();
+    QCOMPARE(data.processCount, 1);
+    QVERIFY(data.topByCpu.isEmpty());
+    QCOMPARE(data.topByMemory.size(), 1);
+    QCOMPARE(data.topByMemory.at(0).name, QString("new"));
+
+    // The new process has a baseline from here on
+    QTest::qWait(20);
+    QVERIFY(writeProcess(dir.path(), {400, "new", 'S', 5010, 10, 9000}));
+    monitor.sample();
+    QCOMPARE(monitor.getCurrentData().topByCpu.size(), 1);
+}
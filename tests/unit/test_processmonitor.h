@@ -0,0 +1,21 @@
+/**
+ * @file test_processmonitor.h
+ * @brief ProcessMonitor unit tests
+ */
+
+#ifndef TEST_PROCESSMONITOR_H
+#define TEST_PROCESSMONITOR_H
+
+#include <QObject>
+#include <QTest>
+
+class TestProcessMonitor : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testCpuFromDeltasAndTopLists();
+    void testPidReuseAndExit();
+};
+
+#endif // TEST_PROCESSMONITOR_H
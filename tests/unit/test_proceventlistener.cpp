@@ -0,0 +1,143 @@
+/**
+ * @file test_proceventlistener.cpp
+ * @brief ProcEventListener unit tests implementation
+ */
+
+#include "test_proceventlistener.h"
+#include "core/proceventlistener.h"
+
+#include <QElapsedTimer>
+#include <cstring>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/cn_proc.h>) && __has_include(<linux/connector.h>)
+#include <linux/cn_proc.h>
+#include <linux/connector.h>
+#include <linux/netlink.h>
+#define TEST_HAVE_CN_PROC 1
+#endif
+#endif
+
+#if defined(TEST_HAVE_CN_PROC)
+namespace {
+
+// Append one connector message carrying a proc_event to buffer
+proc_event* appendEvent(std::vector<char>& buffer, quint32 what)
+{
+    const size_t offset = buffer.size();
+    const size_t payload = sizeof(cn_msg) + sizeof(proc_event);
+    buffer.resize(offset + NLMSG_SPACE(payload), 0);
+
+    nlmsghdr* header = reinterpret_cast<nlmsghdr*>(buffer.data() + offset);
+    header->nlmsg_len = NLMSG_LENGTH(payload);
+    header->nlmsg_type = NLMSG_DONE;
+
+    cn_msg* connector = static_cast<cn_msg*>(NLMSG_DATA(header));
+    connector->id.idx = CN_IDX_PROC;
+    connector->id.val = CN_VAL_PROC;
+    connector->len = sizeof(proc_event);
+
+    proc_event* event = reinterpret_cast<proc_event*>(connector->data);
+    memcpy(&event->what, &what, sizeof(what));
+    return event;
+}
+
+} // namespace
+#endif
+
+void TestProcEventListener::testParseMessages()
+{
+#if defined(TEST_HAVE_CN_PROC)
+    std::vector<char> buffer;
+    buffer.reserve(4096);   // appendEvent() pointers must stay valid
+
+    proc_event* event = appendEvent(buffer, 0x00000001);     // Process fork
+    event->event_data.fork.child_pid = 200;
+    event->event_data.fork.child_tgid = 200;
+    event = appendEvent(buffer, 0x00000001);                 // New thread
+    event->event_data.fork.child_pid = 201;
+    event->event_data.fork.child_tgid = 200;
+    event = appendEvent(buffer, 0x00000002);                 // Exec
+    event->event_data.exec.process_pid = 200;
+    event->event_data.exec.process_tgid = 200;
+    event = appendEvent(buffer, 0x80000000);                 // Thread exit
+    event->event_data.exit.process_pid = 201;
+    event->event_data.exit.process_tgid = 200;
+    event = appendEvent(buffer, 0x80000000);                 // Process exit
+    event->event_data.exit.process_pid = 200;
+    event->event_data.exit.process_tgid = 200;
+    appendEvent(buffer, 0x00000004);                         // UID change, ignored
+
+    std::vector<ProcEvent> events;
+    int error = 0;
+    QCOMPARE(ProcEventListener::parseMessages(buffer.data(), static_cast<qint64>(buffer.size()),
+                                              events, &error), 3);
+    QCOMPARE(error, 0);
+    QCOMPARE(static_cast<int>(events.size()), 3);
+    QCOMPARE(static_cast<int>(events[0].type), static_cast<int>(ProcEvent::Fork));
+    QCOMPARE(static_cast<int>(events[1].type), static_cast<int>(ProcEvent::Exec));
+    QCOMPARE(static_cast<int>(events[2].type), static_cast<int>(ProcEvent::Exit));
+    for (const ProcEvent& parsed : events) {
+        QCOMPARE(parsed.pid, 200);
+    }
+
+    // A refused subscription comes back as an ack carrying the errno
+    buffer.clear();
+    appendEvent(buffer, 0x00000000)->event_data.ack.err = EPERM;
+    events.clear();
+    QCOMPARE(ProcEventListener::parseMessages(buffer.data(), static_cast<qint64>(buffer.size()),
+                                              events, &error), 0);
+    QCOMPARE(error, EPERM);
+
+    // Truncated datagram: nothing read past the end
+    buffer.clear();
+    appendEvent(buffer, 0x00000002)->event_data.exec.process_tgid = 300;
+    QCOMPARE(ProcEventListener::parseMessages(buffer.data(), 8, events), 0);
+    QVERIFY(events.empty());
+#else
+    QSKIP("Proc connector headers not available");
+#endif
+}
+
+void TestProcEventListener::testLiveEvents()
+{
+    ProcEventListener listener;
+    if (!listener.start()) {
+        QSKIP("Proc connector not permitted (needs CAP_NET_ADMIN)");
+    }
+
+    const pid_t child = fork();
+    if (child == 0) {
+        _exit(0);
+    }
+    QVERIFY(child > 0);
+    waitpid(child, nullptr, 0);
+
+    // The socket never blocks: poll until both ends of the child arrive
+    bool forked = false;
+    bool exited = false;
+    std::vector<ProcEvent> events;
+    QElapsedTimer timer;
+    timer.start();
+    while (listener.isActive() && !(forked && exited) && timer.elapsed() < 2000) {
+        events.clear();
+        listener.readEvents(events);
+        for (const ProcEvent& event : events) {
+            if (event.pid != child) continue;
+            forked |= event.type == ProcEvent::Fork;
+            exited |= event.type == ProcEvent::Exit;
+        }
+        if (!(forked && exited)) usleep(1000);
+    }
+
+    if (!listener.isActive()) {
+        QSKIP("Proc connector subscription refused");
+    }
+    QVERIFY(forked);
+    QVERIFY(exited);
+
+    listener.stop();
+    QVERIFY(!listener.isActive());
+}
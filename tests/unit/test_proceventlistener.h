@@ -0,0 +1,21 @@
+/**
+ * @file test_proceventlistener.h
+ * @brief ProcEventListener unit tests
+ */
+
+#ifndef TEST_PROCEVENTLISTENER_H
+#define TEST_PROCEVENTLISTENER_H
+
+#include <QObject>
+#include <QTest>
+
+class TestProcEventListener : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testParseMessages();
+    void testLiveEvents();
+};
+
+#endif // TEST_PROCEVENTLISTENER_H
@@ -0,0 +1,446 @@
+/**
+ * @file test_procparser.cpp
+ * @brief Test implementation for ProcParser
+ */
+
+#include "test_procparser.h"
+#include "core/procparser.h"
+#include "core/procfilereader.h"
+#include "core/constants.h"
+
+#include <cstdlib>
+
+// ===================================================================
+// ALLOCATION COUNTING (glibc only)
+// ===================================================================
+// malloc/calloc/realloc are interposed for the whole test binary and
+// forward to glibc; counting is switched on per thread around the code
+// under test. operator new and Qt containers both end up here.
+
+#if defined(__GLIBC__)
+#define HAVE_ALLOCATION_COUNTER 1
+
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_calloc(size_t count, size_t size);
+extern "C" void* __libc_realloc(void* ptr, size_t size);
+
+namespace {
+thread_local bool g_countAllocations = false;
+thread_local int g_allocationCount = 0;
+}
+
+extern "C" void* malloc(size_t size)
+{
+    if (g_countAllocations) ++g_allocationCount;
+    return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t count, size_t size)
+{
+    if (g_countAllocations) ++g_allocationCount;
+    return __libc_calloc(count, size);
+}
+
+extern "C" void* realloc(void* ptr, size_t size)
+{
+    if (g_countAllocations) ++g_allocationCount;
+    return __libc_realloc(ptr, size);
+}
+#endif
+
+namespace {
+
+// Synthetic /proc/stat with the given number of cores
+QByteArray makeProcStat(int coreCount, qint64 base)
+{
+    QByteArray content = "cpu  " + QByteArray::number(base * coreCount) +
+                         " 10 20 " + QByteArray::number(base * 4 * coreCount) +
+                         " 5 1 2 3 0 0\n";
+    for (int i = 0; i < coreCount; ++i) {
+        content += "cpu" + QByteArray::number(i) + ' ' + QByteArray::number(base + i) +
+                   " 1 2 " + QByteArray::number(base * 4) + " 5 6 7 8 0 0\n";
+    }
+    content += "intr 123456 0 0 0\nctxt 987654\nbtime 1700000000\n";
+    return content;
+}
+
+// Synthetic /proc/net/dev with the given number of veth interfaces
+QByteArray makeNetDev(int interfaceCount)
+{
+    QByteArray content =
+        "Inter-|   Receive                                                |  Transmit\n"
+        " face |bytes    packets errs drop fifo frame compressed multicast|bytes    packets errs drop fifo colls carrier compressed\n";
+    for (int i = 0; i < interfaceCount; ++i) {
+        const QByteArray base = QByteArray::number(1000000 + i);
+        content += " veth" + QByteArray::number(i) + ": " + base + " 1200 0 0 0 0 0 0 " +
+                   base + " 900 0 0 0 0 0 0\n";
+    }
+    return content;
+}
+
+} // namespace
+
+// Memory tests
+void TestProcParser::testParseMemInfo()
+{
+    const QByteArray meminfo =
+        "MemTotal:        1000000 kB\n"
+        "MemFree:          200000 kB\n"
+        "MemAvailable:     600000 kB\n"
+        "Buffers:           50000 kB\n"
+        "Cached:           300000 kB\n"
+        "SwapCached:            0 kB\n"
+        "SwapTotal:        102400 kB\n"
+        "SwapFree:          51200 kB\n"
+        "Dirty:               128 kB\n"
+        "Writeback:            64 kB\n"
+        "Shmem:             16000 kB\n"
+        "SReclaimable:      24000 kB\n"
+        "Committed_AS:     900000 kB\n"
+        "HugePages_Total:       0\n";
+
+    MemoryData memory;
+    QVERIFY(ProcParser::parseMemInfo(meminfo.constData(), meminfo.size(), memory));
+
+    QCOMPARE(memory.totalRAM, 1000000 * BYTES_PER_KB);
+    QCOMPARE(memory.freeRAM, 200000 * BYTES_PER_KB);
+    QCOMPARE(memory.availableRAM, 600000 * BYTES_PER_KB);
+    QCOMPARE(memory.buffers, 50000 * BYTES_PER_KB);
+    QCOMPARE(memory.cached, 300000 * BYTES_PER_KB);
+    QCOMPARE(memory.swapTotal, 102400 * BYTES_PER_KB);
+    QCOMPARE(memory.swapUsed, 51200 * BYTES_PER_KB);
+    QCOMPARE(memory.dirty, 128 * BYTES_PER_KB);
+    QCOMPARE(memory.writeback, 64 * BYTES_PER_KB);
+    QCOMPARE(memory.shmem, 16000 * BYTES_PER_KB);
+    QCOMPARE(memory.sReclaimable, 24000 * BYTES_PER_KB);
+    QCOMPARE(memory.committedAS, 900000 * BYTES_PER_KB);
+
+    // Used = Total - Available
+    QCOMPARE(memory.usedRAM, 400000 * BYTES_PER_KB);
+}
+
+void TestProcParser::testParseMemInfoWithoutMemAvailable()
+{
+    // Pre-3.14 kernels have no MemAvailable line
+    const QByteArray meminfo =
+        "MemTotal:        1000000 kB\n"
+        "MemFree:          200000 kB\n"
+        "Buffers:           50000 kB\n"
+        "Cached:           300000 kB\n";
+
+    MemoryData memory;
+    QVERIFY(ProcParser::parseMemInfo(meminfo.constData(), meminfo.size(), memory));
+    QCOMPARE(memory.availableRAM, 550000 * BYTES_PER_KB);
+    QCOMPARE(memory.usedRAM, 450000 * BYTES_PER_KB);
+
+    // No MemTotal, no result
+    const QByteArray broken = "MemFree: 1 kB\n";
+    MemoryData empty;
+    QVERIFY(!ProcParser::parseMemInfo(broken.constData(), broken.size(), empty));
+}
+
+void TestProcParser::testParseMemInfoLive()
+{
+    ProcFileReader reader(PROC_MEMINFO);
+    QVERIFY(reader.read() > 0);
+
+    MemoryData memory;
+    QVERIFY(ProcParser::parseMemInfo(reader.data(), reader.size(), memory));
+    QVERIFY(memory.totalRAM > 0);
+    QVERIFY(memory.usedRAM >= 0);
+    QVERIFY(memory.usedRAM <= memory.totalRAM);
+    QVERIFY(memory.availableRAM <= memory.totalRAM);
+}
+
+// CPU tests
+void TestProcParser::testParseCPUStat()
+{
+    const QByteArray stat = makeProcStat(4, 1000);
+
+    CPUStat total;
+    CPUStatArrays cores;
+    cores.resize(4);
+    QVERIFY(ProcParser::parseCPUStat(stat.constData(), stat.size(), total, cores));
+
+    QCOMPARE(total.user, qint64(4000));
+    QCOMPARE(total.nice, qint64(10));
+    QCOMPARE(total.idle, qint64(16000));
+    QCOMPARE(total.steal, qint64(3));
+
+    for (int i = 0; i < cores.count(); ++i) {
+        const CPUStat core = cores.at(i);
+        QCOMPARE(core.user, qint64(1000 + i));
+        QCOMPARE(core.idle, qint64(4000));
+        QCOMPARE(core.softirq, qint64(7));
+        QCOMPARE(core.steal, qint64(8));
+        QCOMPARE(core.total(), qint64(1000 + i + 1 + 2 + 4000 + 5 + 6 + 7 + 8));
+    }
+}
+
+void TestProcParser::testParseCPUStatOfflineCore()
+{
+    // cpu1 offline: its line is missing, cpu2 must still land in slot 2
+    const QByteArray stat =
+        "cpu  300 0 0 900 0 0 0 0\n"
+        "cpu0 100 0 0 300 0 0 0 0\n"
+        "cpu2 200 0 0 600 0 0 0 0\n"
+        "intr 1 2 3\n";
+
+    CPUStat total;
+    CPUStatArrays cores;
+    cores.resize(3);
+    cores.column(CPUStatArrays::User)[1] = 42; // stale value must be cleared
+    QVERIFY(ProcParser::parseCPUStat(stat.constData(), stat.size(), total, cores));
+
+    QCOMPARE(cores.at(0).user, qint64(100));
+    QCOMPARE(cores.at(1).user, qint64(0));
+    QCOMPARE(cores.at(1).total(), qint64(0));
+    QCOMPARE(cores.at(2).user, qint64(200));
+    QCOMPARE(cores.at(2).idle, qint64(600));
+}
+
+void TestProcParser::testParseCPUStatNoAllocations()
+{
+#if defined(HAVE_ALLOCATION_COUNTER)
+    const int coreCount = 64;
+    const QByteArray stat = makeProcStat(coreCount, 123456789);
+
+    CPUStat total;
+    CPUStatArrays cores;
+    cores.resize(coreCount);
+
+    // Warm-up pass, then count steady-state passes
+    ProcParser::parseCPUStat(stat.constData(), stat.size(), total, cores);
+
+    g_allocationCount = 0;
+    g_countAllocations = true;
+    for (int i = 0; i < 100; ++i) {
+        ProcParser::parseCPUStat(stat.constData(), stat.size(), total, cores);
+    }
+    g_countAllocations = false;
+
+    QCOMPARE(g_allocationCount, 0);
+    QCOMPARE(cores.column(CPUStatArrays::User)[coreCount - 1], quint64(123456789 + coreCount - 1));
+#else
+    QSKIP("Allocation counting needs glibc");
+#endif
+}
+
+void TestProcParser::testParseProcStatCounters()
+{
+    const QByteArray stat =
+        "cpu  300 0 0 900 0 0 0 0\n"
+        "cpu0 300 0 0 900 0 0 0 0\n"
+        "intr 5000 10 20 30 40\n"
+        "ctxt 123456\n"
+        "btime 1700000000\n"
+        "processes 4242\n"
+        "procs_running 3\n"
+        "procs_blocked 1\n"
+        "softirq 777 1 2 3 4 5 6 7 8 9 10\n";
+
+    CPUStat total;
+    CPUStatArrays cores;
+    cores.resize(1);
+    ProcStatCounters counters;
+    QVERIFY(ProcParser::parseCPUStat(stat.constData(), stat.size(), total, cores, &counters));
+
+    QCOMPARE(counters.interrupts, qint64(5000));
+    QCOMPARE(counters.contextSwitches, qint64(123456));
+    QCOMPARE(counters.bootTime, qint64(1700000000));
+    QCOMPARE(counters.processesCreated, qint64(4242));
+    QCOMPARE(counters.procsRunning, 3);
+    QCOMPARE(counters.procsBlocked, 1);
+    QCOMPARE(counters.softirqs, qint64(777));
+}
+
+void TestProcParser::testParseNetDev()
+{
+    const QByteArray netDev =
+        "Inter-|   Receive                                                |  Transmit\n"
+        " face |bytes    packets errs drop fifo frame compressed multicast|bytes    packets errs drop fifo colls carrier compressed\n"
+        "    lo:  123456     789    0    0    0     0          0         0   123456     789    0    0    0     0       0          0\n"
+        "  eth0:18446744073709551000 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16\n"
+        " wlan0: 1 2 3\n";
+
+    std::vector<NetDevStat> stats;
+    QCOMPARE(ProcParser::parseNetDev(netDev.constData(), netDev.size(), stats), 2);
+    QCOMPARE(static_cast<int>(stats.size()), 2);
+
+    QCOMPARE(QByteArray(stats[0].name, stats[0].nameLength), QByteArray("lo"));
+    QCOMPARE(stats[0].counters[NetDevStat::RxBytes], quint64(123456));
+    QCOMPARE(stats[0].counters[NetDevStat::TxPackets], quint64(789));
+
+    // Every column lands in its own counter, 64-bit values included
+    QCOMPARE(QByteArray(stats[1].name, stats[1].nameLength), QByteArray("eth0"));
+    QCOMPARE(stats[1].counters[NetDevStat::RxBytes], quint64(18446744073709551000ULL));
+    for (int i = NetDevStat::RxPackets; i < NetDevStat::CounterCount; ++i) {
+        QCOMPARE(stats[1].counters[i], quint64(i + 1));
+    }
+}
+
+void TestProcParser::testParseNetDevManyInterfaces()
+{
+    const int interfaceCount = 5000;
+    const QByteArray netDev = makeNetDev(interfaceCount);
+    std::vector<NetDevStat> stats;
+
+    // Warm-up pass sizes the vector, later passes parse in place
+    QCOMPARE(ProcParser::parseNetDev(netDev.constData(), netDev.size(), stats), interfaceCount);
+
+#if defined(HAVE_ALLOCATION_COUNTER)
+    g_allocationCount = 0;
+    g_countAllocations = true;
+#endif
+    for (int i = 0; i < 20; ++i) {
+        ProcParser::parseNetDev(netDev.constData(), netDev.size(), stats);
+    }
+#if defined(HAVE_ALLOCATION_COUNTER)
+    g_countAllocations = false;
+    QCOMPARE(g_allocationCount, 0);
+#endif
+    QCOMPARE(stats[interfaceCount - 1].counters[NetDevStat::TxBytes], quint64(1000000 + interfaceCount - 1));
+    QCOMPARE(QByteArray(stats[42].name, stats[42].nameLength), QByteArray("veth42"));
+}
+
+void TestProcParser::testParseDiskStats()
+{
+    // 5.5+ layout, 4.18 layout (no flush columns), pre-4.18 and a cut line
+    const QByteArray diskStats =
+        " 179       0 mmcblk0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17\n"
+        " 179       2 mmcblk0p2 100 0 800 50 200 0 1600 70 1 90 120 0 0 0 0\n"
+        "   8       0 sda 5000000000 0 10 20 30 0 40 50 2 60 70\n"
+        "   8       1 sda1 1 2 3\n";
+
+    std::vector<DiskStat> devices;
+    QCOMPARE(ProcParser::parseDiskStats(diskStats.constData(), diskStats.size(), devices), 3);
+
+    QCOMPARE(QByteArray(devices[0].name, devices[0].nameLength), QByteArray("mmcblk0"));
+    QCOMPARE(devices[0].devMajor, 179u);
+    QCOMPARE(devices[0].devMinor, 0u);
+    for (int i = 0; i < DiskStat::CounterCount; ++i) {
+        QCOMPARE(devices[0].counters[i], quint64(i + 1));
+    }
+
+    QCOMPARE(devices[1].devMinor, 2u);
+    QCOMPARE(devices[1].counters[DiskStat::SectorsWritten], quint64(1600));
+    QCOMPARE(devices[1].counters[DiskStat::WeightedIoTimeMs], quint64(120));
+    QCOMPARE(devices[1].counters[DiskStat::FlushesCompleted], quint64(0));
+
+    // Columns the kernel does not have read as zero
+    QCOMPARE(QByteArray(devices[2].name, devices[2].nameLength), QByteArray("sda"));
+    QCOMPARE(devices[2].counters[DiskStat::ReadsCompleted], quint64(5000000000ULL));
+    QCOMPARE(devices[2].counters[DiskStat::IoTimeMs], quint64(60));
+    QCOMPARE(devices[2].counters[DiskStat::DiscardsCompleted], quint64(0));
+    QCOMPARE(devices[2].counters[DiskStat::FlushTimeMs], quint64(0));
+}
+
+void TestProcParser::testParseMounts()
+{
+    const QByteArray mounts =
+        "/dev/root / ext4 rw,noatime 0 0\n"
+        "tmpfs /run tmpfs rw,nosuid,nodev 0 0\n"
+        "/dev/sda1 /media/usb\\040disk vfat rw 0 0\n"
+        "broken\n";
+
+    QVector<MountEntry> entries;
+    QCOMPARE(ProcParser::parseMounts(mounts.constData(), mounts.size(), entries), 3);
+
+    QCOMPARE(entries.at(0).device, QString("/dev/root"));
+    QCOMPARE(entries.at(0).mountPoint, QString("/"));
+    QCOMPARE(entries.at(0).fileSystem, QString("ext4"));
+    QCOMPARE(entries.at(1).fileSystem, QString("tmpfs"));
+    QCOMPARE(entries.at(2).mountPoint, QString("/media/usb disk"));
+    QCOMPARE(entries.at(2).fileSystem, QString("vfat"));
+}
+
+void TestProcParser::testParseLoadAvg()
+{
+    const QByteArray loadavg = "0.20 1.18 12.05 3/812 11206\n";
+
+    LoadAvgStat load;
+    QVERIFY(ProcParser::parseLoadAvg(loadavg.constData(), loadavg.size(), load));
+    QCOMPARE(load.load1, 0.20);
+    QCOMPARE(load.load5, 1.18);
+    QCOMPARE(load.load15, 12.05);
+    QCOMPARE(load.runningTasks, 3);
+    QCOMPARE(load.totalTasks, 812);
+
+    const QByteArray truncated = "0.20 1.18 12.05 3";
+    QVERIFY(!ProcParser::parseLoadAvg(truncated.constData(), truncated.size(), load));
+}
+
+void TestProcParser::testParseUptime()
+{
+    const QByteArray uptime = "350735.47 1234388.90\n";
+
+    double uptimeSeconds = 0.0;
+    double idleSeconds = 0.0;
+    QVERIFY(ProcParser::parseUptime(uptime.constData(), uptime.size(), &uptimeSeconds, &idleSeconds));
+    QCOMPARE(uptimeSeconds, 350735.47);
+    QCOMPARE(idleSeconds, 1234388.90);
+
+    QVERIFY(!ProcParser::parseUptime("", 0, &uptimeSeconds));
+}
+
+void TestProcParser::testParsePidStat()
+{
+    // The command name contains both a space and a ')'
+    const QByteArray stat =
+        "4242 (tmux: serv) er) S 1 4242 4242 0 -1 4194560 1520 0 3 0 "
+        "123 45 0 0 20 0 2 0 98765 12345678 321 18446744073709551615 1 1 0 0 0 0 0\n";
+
+    ProcPidStat process;
+    QVERIFY(ProcParser::parsePidStat(stat.constData(), stat.size(), process));
+    QCOMPARE(process.pid, 4242);
+    QCOMPARE(QByteArray(process.comm, process.commLength), QByteArray("tmux: serv) er"));
+    QCOMPARE(process.state, 'S');
+    QCOMPARE(process.parentPid, 1);
+    QCOMPARE(process.userTime, quint64(123));
+    QCOMPARE(process.systemTime, quint64(45));
+    QCOMPARE(process.threadCount, 2);
+    QCOMPARE(process.startTime, quint64(98765));
+    QCOMPARE(process.virtualSize, quint64(12345678));
+    QCOMPARE(process.residentPages, qint64(321));
+
+    // Cut before the rss field
+    const QByteArray truncated = "7 (sh) S 1 7 7 0 -1 0 0 0 0 0 1 1 0 0 20 0 1 0 5 100";
+    QVERIFY(!ProcParser::parsePidStat(truncated.constData(), truncated.size(), process));
+}
+
+void TestProcParser::testParsePidStatm()
+{
+    const QByteArray statm = "2560 321 77 12 0 150 0\n";
+
+    ProcPidStatm memory;
+    QVERIFY(ProcParser::parsePidStatm(statm.constData(), statm.size(), memory));
+    QCOMPARE(memory.size, qint64(2560));
+    QCOMPARE(memory.resident, qint64(321));
+    QCOMPARE(memory.shared, qint64(77));
+    QCOMPARE(memory.text, qint64(12));
+    QCOMPARE(memory.data, qint64(150));
+}
+
+// Performance tests
+void TestProcParser::benchmarkParseNetDev_data()
+{
+    QTest::addColumn<int>("interfaceCount");
+
+    for (int interfaceCount : {4, 500, 5000}) {
+        QTest::newRow(QByteArray::number(interfaceCount).constData()) << interfaceCount;
+    }
+}
+
+void TestProcParser::benchmarkParseNetDev()
+{
+    QFETCH(int, interfaceCount);
+
+    const QByteArray netDev = makeNetDev(interfaceCount);
+    std::vector<NetDevStat> stats;
+    ProcParser::parseNetDev(netDev.constData(), netDev.size(), stats);
+
+    QBENCHMARK {
+        ProcParser::parseNetDev(netDev.constData(), netDev.size(), stats);
+    }
+    QCOMPARE(static_cast<int>(stats.size()), interfaceCount);
+}
@@ -0,0 +1,49 @@
+/**
+ * @file test_procparser.h
+ * @brief Tests for ProcParser byte-level parsers
+ */
+
+#ifndef TEST_PROCPARSER_H
+#define TEST_PROCPARSER_H
+
+#include <QObject>
+#include <QTest>
+
+class TestProcParser : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Memory tests
+    void testParseMemInfo();
+    void testParseMemInfoWithoutMemAvailable();
+    void testParseMemInfoLive();
+
+    // CPU tests
+    void testParseCPUStat();
+    void testParseCPUStatOfflineCore();
+    void testParseCPUStatNoAllocations();
+    void testParseProcStatCounters();
+
+    // Network tests
+    void testParseNetDev();
+    void testParseNetDevManyInterfaces();
+
+    // Storage tests
+    void testParseDiskStats();
+    void testParseMounts();
+
+    // System load tests
+    void testParseLoadAvg();
+    void testParseUptime();
+
+    // Process tests
+    void testParsePidStat();
+    void testParsePidStatm();
+
+    // Performance tests
+    void benchmarkParseNetDev_data();
+    void benchmarkParseNetDev();
+};
+
+#endif // TEST_PROCPARSER_H
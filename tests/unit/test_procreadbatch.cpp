@@ -0,0 +1,134 @@
+/**
+ * @file test_procreadbatch.cpp
+ * @brief Test implementation for ProcReadBatch
+ */
+
+#include "test_procreadbatch.h"
+#include "core/procreadbatch.h"
+#include "core/constants.h"
+#include "core/cpufrequencysampler.h"
+#include "core/systemutils.h"
+#include "core/thermalsampler.h"
+#include "testhelpers.h"
+
+#include <QElapsedTimer>
+#include <QTemporaryDir>
+#include <ctime>
+
+Q_DECLARE_METATYPE(ProcReadBatch::Backend)
+
+namespace {
+
+void addBackendRows()
+{
+    QTest::addColumn<ProcReadBatch::Backend>("backend");
+
+    QTest::newRow("pread") << ProcReadBatch::Backend::Pread;
+    if (ProcReadBatch::isIoUringSupported()) {
+        QTest::newRow("io_uring") << ProcReadBatch::Backend::IoUring;
+    }
+}
+
+} // namespace
+
+// Correctness tests
+void TestProcReadBatch::testMatchesDirectRead_data()
+{
+    addBackendRows();
+}
+
+void TestProcReadBatch::testMatchesDirectRead()
+{
+    QFETCH(ProcReadBatch::Backend, backend);
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    // Small sysfs-style value, a file larger than the initial buffer
+    // and a file that does not exist
+    const QByteArray small("48250\n");
+    const QByteArray large(20000, 'x');
+    QVERIFY(writeFile(dir.filePath("small"), small));
+    QVERIFY(writeFile(dir.filePath("large"), large));
+
+    ProcFileReader smallReader(dir.filePath("small"), 64);
+    ProcFileReader largeReader(dir.filePath("large"), 64);
+    ProcFileReader missingReader(dir.filePath("missing"), 64);
+
+    ProcReadBatch batch(backend);
+    batch.addReader(&smallReader);
+    batch.addReader(&largeReader);
+    batch.addReader(&missingReader);
+    QCOMPARE(batch.backend(), backend);
+
+    for (int tick = 0; tick < 3; ++tick) {
+        QCOMPARE(batch.readAll(), 2);
+        QCOMPARE(QByteArray(smallReader.data(), static_cast<int>(smallReader.size())), small);
+        QCOMPARE(QByteArray(largeReader.data(), static_cast<int>(largeReader.size())), large);
+        QCOMPARE(missingReader.size(), qint64(0));
+
+        qint64 value = 0;
+        QVERIFY(smallReader.toInt64(&value));
+        QCOMPARE(value, qint64(48250));
+    }
+}
+
+// Performance tests
+void TestProcReadBatch::benchmarkTick_data()
+{
+    addBackendRows();
+}
+
+void TestProcReadBatch::benchmarkTick()
+{
+    QFETCH(ProcReadBatch::Backend, backend);
+
+    // The CPU tick's file set plus /proc/meminfo
+    ProcFileReader statReader(PROC_STAT, 16384);
+    ProcFileReader meminfoReader(PROC_MEMINFO, 8192);
+    ThermalSampler thermal;
+    CPUFrequencySampler frequency;
+    thermal.discover();
+    frequency.discover(SystemUtils::getCPUCoreCount());
+
+    ProcReadBatch batch(backend);
+    batch.addReader(&statReader);
+    batch.addReader(&meminfoReader);
+    thermal.addReaders(batch);
+    frequency.addReaders(batch);
+
+    // 1 kHz: one tick per absolute millisecond deadline
+    const int ticks = 1000;
+    const long periodNs = 1000000;
+    batch.readAll();
+    batch.resetSyscallCount();
+
+    qint64 totalNs = 0;
+    qint64 worstNs = 0;
+    timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+
+    for (int tick = 0; tick < ticks; ++tick) {
+        deadline.tv_nsec += periodNs;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_nsec -= 1000000000L;
+            ++deadline.tv_sec;
+        }
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, nullptr);
+
+        QElapsedTimer timer;
+        timer.start();
+        batch.readAll();
+        const qint64 elapsed = timer.nsecsElapsed();
+        totalNs += elapsed;
+        worstNs = qMax(worstNs, elapsed);
+    }
+
+    qDebug().nospace() << ProcReadBatch::backendName(batch.backend()) << ": "
+                       << batch.readerCount() << " files, "
+                       << double(batch.syscallCount()) / ticks << " syscalls/tick, "
+                       << totalNs / ticks / 1000.0 << " us/tick mean, "
+                       << worstNs / 1000.0 << " us worst";
+
+    QTest::setBenchmarkResult(double(totalNs) / ticks, QTest::WalltimeNanoseconds);
+}
@@ -0,0 +1,26 @@
+/**
+ * @file test_procreadbatch.h
+ * @brief Tests and 1 kHz benchmark for batched per-tick reads
+ */
+
+#ifndef TEST_PROCREADBATCH_H
+#define TEST_PROCREADBATCH_H
+
+#include <QObject>
+#include <QTest>
+
+class TestProcReadBatch : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Correctness tests
+    void testMatchesDirectRead_data();
+    void testMatchesDirectRead();
+
+    // Performance tests
+    void benchmarkTick_data();
+    void benchmarkTick();
+};
+
+#endif // TEST_PROCREADBATCH_H
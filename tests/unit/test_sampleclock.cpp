@@ -0,0 +1,50 @@
+/**
+ * @file test_sampleclock.cpp
+ * @brief Test implementation for SampleClock
+ */
+
+#include "test_sampleclock.h"
+#include "core/sampleclock.h"
+#include "core/types.h"
+
+void TestSampleClock::testMonotonic()
+{
+    qint64 previous = SampleClock::nowNs();
+    QVERIFY(previous > 0);
+
+    for (int i = 0; i < 1000; ++i) {
+        const qint64 now = SampleClock::nowNs();
+        QVERIFY(now >= previous);
+        previous = now;
+    }
+}
+
+void TestSampleClock::testWallClockConversion()
+{
+    const qint64 stamp = SampleClock::nowNs();
+    const qint64 wallMs = QDateTime::currentMSecsSinceEpoch();
+
+    // Same instant through the session anchor, within scheduling noise
+    QVERIFY(qAbs(SampleClock::toWallMs(stamp) - wallMs) < 50);
+    QCOMPARE(SampleClock::toWallMs(stamp + 1500000000LL), SampleClock::toWallMs(stamp) + 1500);
+
+    QVERIFY(SampleClock::toDateTime(stamp).isValid());
+    QVERIFY(!SampleClock::toDateTime(0).isValid());
+}
+
+void TestSampleClock::testSecondsBetween()
+{
+    QCOMPARE(SampleClock::secondsBetween(1000000000LL, 3500000000LL), 2.5);
+    QCOMPARE(SampleClock::secondsBetween(0, 3500000000LL), 0.0);
+    QCOMPARE(SampleClock::secondsBetween(3500000000LL, 1000000000LL), 0.0);
+}
+
+void TestSampleClock::testDataUnstampedByDefault()
+{
+    // Constructing sample structs must not touch any clock
+    CPUData cpu;
+    MemoryData memory;
+    QCOMPARE(cpu.timestampNs, qint64(0));
+    QCOMPARE(memory.timestampNs, qint64(0));
+    QVERIFY(!cpu.timestamp().isValid());
+}
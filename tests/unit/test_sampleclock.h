@@ -0,0 +1,23 @@
+/**
+ * @file test_sampleclock.h
+ * @brief Tests for monotonic sample timestamps
+ */
+
+#ifndef TEST_SAMPLECLOCK_H
+#define TEST_SAMPLECLOCK_H
+
+#include <QObject>
+#include <QTest>
+
+class TestSampleClock : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testMonotonic();
+    void testWallClockConversion();
+    void testSecondsBetween();
+    void testDataUnstampedByDefault();
+};
+
+#endif // TEST_SAMPLECLOCK_H
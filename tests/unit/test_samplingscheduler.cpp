@@ -0,0 +1,114 @@
+/**
+ * @file test_samplingscheduler.cpp
+ * @brief Test implementation for SamplingScheduler
+ */
+
+#include "test_samplingscheduler.h"
+#include "model/base/basemonitor.h"
+#include "model/base/samplingscheduler.h"
+
+#include <QCoreApplication>
+#include <QSignalSpy>
+
+namespace {
+
+// Minimal monitor counting its samples
+class CountingMonitor : public BaseMonitor
+{
+public:
+    explicit CountingMonitor(int intervalMs) : samples(0) { setUpdateInterval(intervalMs); }
+
+    int samples;
+
+protected:
+    void collectData() override { ++samples; }
+    void processData() override {}
+    void validateData() override {}
+    void emitSignal() override {}
+};
+
+} // namespace
+
+void TestSamplingScheduler::testPhaseAlignedBatches()
+{
+    CountingMonitor fast(100);
+    CountingMonitor slow(200);
+
+    SamplingScheduler scheduler(50);
+    scheduler.addMonitor(&fast);
+    scheduler.addMonitor(&slow);
+    QVERIFY(fast.isExternallyScheduled());
+
+    fast.startMonitoring();
+    slow.startMonitoring();
+
+    QSignalSpy batches(&scheduler, &SamplingScheduler::batchCompleted);
+    scheduler.start();
+    QTest::qWait(1050);
+    scheduler.stop();
+
+    QVERIFY(fast.samples >= 8);
+    QVERIFY(qAbs(slow.samples - fast.samples / 2) <= 1);
+
+    // The slow monitor always shares a wakeup with the fast one, and
+    // idle base ticks cost nothing
+    QCOMPARE(scheduler.wakeupCount(), quint64(fast.samples));
+    QCOMPARE(batches.count(), fast.samples);
+}
+
+void TestSamplingScheduler::testPausedMonitorSkipped()
+{
+    CountingMonitor monitor(100);
+
+    SamplingScheduler scheduler(100);
+    scheduler.addMonitor(&monitor);
+    monitor.startMonitoring();
+    monitor.pauseMonitoring();
+
+    scheduler.start();
+    QTest::qWait(350);
+    scheduler.stop();
+
+    QCOMPARE(monitor.samples, 0);
+    QVERIFY(scheduler.wakeupCount() >= 2);
+}
+
+void TestSamplingScheduler::testRemoveMonitor()
+{
+    CountingMonitor monitor(100);
+
+    SamplingScheduler scheduler(100);
+    scheduler.addMonitor(&monitor);
+    scheduler.removeMonitor(&monitor);
+    QVERIFY(!monitor.isExternallyScheduled());
+
+    scheduler.start();
+    QTest::qWait(250);
+    scheduler.stop();
+
+    QCOMPARE(scheduler.wakeupCount(), quint64(0));
+    QCOMPARE(monitor.samples, 0);
+}
+
+void TestSamplingScheduler::testParkedMonitorCostsNoWakeups()
+{
+    CountingMonitor monitor(100);
+    monitor.setDemandDriven(true);
+
+    SamplingScheduler scheduler(100);
+    scheduler.addMonitor(&monitor);
+    monitor.startMonitoring();
+    QCoreApplication::processEvents();
+    QVERIFY(monitor.isParked());
+
+    scheduler.start();
+    QTest::qWait(350);
+    QCOMPARE(scheduler.wakeupCount(), quint64(0));
+
+    // Subscribing re-phases it into the schedule
+    MonitorSubscription subscription = monitor.subscribe();
+    QTest::qWait(350);
+    scheduler.stop();
+
+    QVERIFY(monitor.samples >= 2);
+}
@@ -0,0 +1,23 @@
+/**
+ * @file test_samplingscheduler.h
+ * @brief Tests for the single-timer sampling scheduler
+ */
+
+#ifndef TEST_SAMPLINGSCHEDULER_H
+#define TEST_SAMPLINGSCHEDULER_H
+
+#include <QObject>
+#include <QTest>
+
+class TestSamplingScheduler : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testPhaseAlignedBatches();
+    void testPausedMonitorSkipped();
+    void testRemoveMonitor();
+    void testParkedMonitorCostsNoWakeups();
+};
+
+#endif // TEST_SAMPLINGSCHEDULER_H
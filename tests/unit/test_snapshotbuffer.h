@@ -0,0 +1,27 @@
+/**
+ * @file test_snapshotbuffer.h
+ * @brief Tests and reader contention benchmark for SnapshotBuffer
+ */
+
+#ifndef TEST_SNAPSHOTBUFFER_H
+#define TEST_SNAPSHOTBUFFER_H
+
+#include <QObject>
+#include <QTest>
+
+class TestSnapshotBuffer : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Correctness tests
+    void testDefaultBeforePublish();
+    void testLatestValueWins();
+    void testConsistentUnderContention();
+
+    // Performance tests
+    void benchmarkReaders_data();
+    void benchmarkReaders();
+};
+
+#endif // TEST_SNAPSHOTBUFFER_H
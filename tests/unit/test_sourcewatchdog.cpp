@@ -0,0 +1,189 @@
+/**
+ * @file test_sourcewatchdog.cpp
+ * @brief Test implementation for SourceWatchdog
+ *
+ * A FIFO without a writer stands in for a wedged driver or a dead NFS
+ * mount: open() on it blocks until a writer shows up.
+ */
+
+#include "test_sourcewatchdog.h"
+#include "core/sourcewatchdog.h"
+
+#include <QElapsedTimer>
+#include <QTemporaryDir>
+#include <QThread>
+#include <atomic>
+#include <cerrno>
+#include <fcntl.h>
+#include <memory>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+// Read source that blocks in open() until unblock() feeds the FIFO
+class BlockingFifo
+{
+public:
+    explicit BlockingFifo(const QString& path)
+        : m_path(path.toLocal8Bit())
+        , m_attempts(std::make_shared<std::atomic<int>>(0))
+    {
+        m_created = ::mkfifo(m_path.constData(), 0600) == 0;
+    }
+
+    bool isValid() const { return m_created; }
+    int attempts() const { return m_attempts->load(); }
+
+    SourceWatchdog::ReadFunction reader() const
+    {
+        const QByteArray path = m_path;
+        std::shared_ptr<std::atomic<int>> counter = m_attempts;
+        return [path, counter] {
+            ++*counter;
+            const int fd = ::open(path.constData(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0) return false;
+
+            char buffer[16];
+            const ssize_t bytesRead = ::read(fd, buffer, sizeof(buffer));
+            ::close(fd);
+            return bytesRead > 0;
+        };
+    }
+
+    // Wait for the reader to block in open(), then let it through
+    bool unblock() const
+    {
+        for (int i = 0; i < 200; ++i) {
+            const int fd = ::open(m_path.constData(), O_WRONLY | O_NONBLOCK | O_CLOEXEC);
+            if (fd >= 0) {
+                const bool written = ::write(fd, "42\n", 3) == 3;
+                ::close(fd);
+                return written;
+            }
+            if (errno != ENXIO) return false;
+            QThread::msleep(5);
+        }
+        return false;
+    }
+
+private:
+    QByteArray m_path;
+    bool m_created;
+    std::shared_ptr<std::atomic<int>> m_attempts;   // Shared with the read function
+};
+
+// Wait until a background read has finished and been picked up
+bool collectUntilIdle(SourceWatchdog& watchdog, int source)
+{
+    for (int i = 0; i < 200; ++i) {
+        watchdog.collect();
+        if (!watchdog.isInFlight(source)) return true;
+        QThread::msleep(5);
+    }
+    return false;
+}
+
+} // namespace
+
+void TestSourceWatchdog::testHungSourceGoesStale()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    BlockingFifo fifo(dir.filePath("wedged"));
+    QVERIFY(fifo.isValid());
+
+    std::shared_ptr<std::atomic<int>> fastReads = std::make_shared<std::atomic<int>>(0);
+    SourceWatchdog watchdog;
+    const int fast = watchdog.addSource("fast", [fastReads] { ++*fastReads; return true; });
+    const int hung = watchdog.addSource("fifo", fifo.reader(), 200);
+    QCOMPARE(watchdog.status(fast), MetricStatus::Unknown);
+
+    // The tick waits for the deadline, not for the hung read
+    QElapsedTimer timer;
+    timer.start();
+    QCOMPARE(watchdog.collect(), 1);
+    QVERIFY(timer.elapsed() < 1000);
+
+    QVERIFY(watchdog.isFresh(fast));
+    QCOMPARE(watchdog.status(fast), MetricStatus::Normal);
+    QVERIFY(!watchdog.isFresh(hung));
+    QVERIFY(watchdog.isStale(hung));
+    QVERIFY(watchdog.isInFlight(hung));
+    QCOMPARE(watchdog.status(hung), MetricStatus::Unknown);
+    QCOMPARE(watchdog.timeoutCount(hung), quint64(1));
+
+    // Later ticks run the healthy source alone, without waiting
+    timer.restart();
+    QCOMPARE(watchdog.collect(), 1);
+    QVERIFY(timer.elapsed() < 100);
+    QCOMPARE(fastReads->load(), 2);
+    QCOMPARE(fifo.attempts(), 1);
+
+    QVERIFY(fifo.unblock());
+    QVERIFY(collectUntilIdle(watchdog, hung));
+}
+
+void TestSourceWatchdog::testRetryBackoffAndRecovery()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    BlockingFifo fifo(dir.filePath("flaky"));
+    QVERIFY(fifo.isValid());
+
+    SourceWatchdog watchdog;
+    watchdog.setRetryBackoff(100, 400);
+    const int source = watchdog.addSource("fifo", fifo.reader(), 200);
+
+    watchdog.collect();
+    QVERIFY(watchdog.isStale(source));
+    QCOMPARE(watchdog.retryDelayMs(source), 100);
+
+    // The hung read returning late frees the worker but does not recover
+    QVERIFY(fifo.unblock());
+    QVERIFY(collectUntilIdle(watchdog, source));
+    QVERIFY(watchdog.isStale(source));
+    QVERIFY(!watchdog.isFresh(source));
+    QCOMPARE(fifo.attempts(), 1);
+
+    // Backoff elapsed: one background retry, with the delay doubled
+    QThread::msleep(120);
+    QElapsedTimer timer;
+    timer.start();
+    watchdog.collect();
+    QVERIFY(timer.elapsed() < 100);
+    QTRY_COMPARE(fifo.attempts(), 2);
+    QCOMPARE(watchdog.retryDelayMs(source), 200);
+    QVERIFY(watchdog.isInFlight(source));
+
+    // The retry succeeds: fresh again, backoff reset
+    QVERIFY(fifo.unblock());
+    QVERIFY(collectUntilIdle(watchdog, source));
+    QVERIFY(watchdog.isFresh(source));
+    QVERIFY(!watchdog.isStale(source));
+    QCOMPARE(watchdog.status(source), MetricStatus::Normal);
+    QCOMPARE(watchdog.retryDelayMs(source), 0);
+    QCOMPARE(watchdog.timeoutCount(source), quint64(1));
+}
+
+void TestSourceWatchdog::testDestroyWithHungSource()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    BlockingFifo fifo(dir.filePath("stuck"));
+    QVERIFY(fifo.isValid());
+
+    QElapsedTimer timer;
+    timer.start();
+    {
+        SourceWatchdog watchdog;
+        const int source = watchdog.addSource("fifo", fifo.reader(), 20);
+        watchdog.collect();
+        QVERIFY(watchdog.isStale(source));
+    }
+    // The stuck worker was detached, not joined
+    QVERIFY(timer.elapsed() < 1000);
+
+    // Let the detached worker finish before the FIFO goes away
+    QVERIFY(fifo.unblock());
+}
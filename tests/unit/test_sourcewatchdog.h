@@ -0,0 +1,22 @@
+/**
+ * @file test_sourcewatchdog.h
+ * @brief Tests for deadline-bounded source collection
+ */
+
+#ifndef TEST_SOURCEWATCHDOG_H
+#define TEST_SOURCEWATCHDOG_H
+
+#include <QObject>
+#include <QTest>
+
+class TestSourceWatchdog : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testHungSourceGoesStale();
+    void testRetryBackoffAndRecovery();
+    void testDestroyWithHungSource();
+};
+
+#endif // TEST_SOURCEWATCHDOG_H
@@ -0,0 +1,191 @@
+/**
+ * @file test_storagemonitor.cpp
+ * @brief StorageMonitor unit tests implementation
+ *
+ * /proc/diskstats and /proc/mounts are temporary files, rewritten in
+ * place between samples. Capacity comes from statvfs() on the
+ * temporary directory.
+ */
+
+#include "test_storagemonitor.h"
+#include "model/monitors/storagemonitor.h"
+#include "core/systeminfocache.h"
+#include "testhelpers.h"
+
+#include <QFile>
+#include <QTemporaryDir>
+
+namespace {
+
+// "major minor name" and the 11 classic counters
+QByteArray diskLine(const char* device, int minor, std::initializer_list<quint64> counters)
+{
+    QByteArray line = "   8 " + QByteArray::number(minor) + ' ' + QByteArray(device);
+    for (quint64 counter : counters) {
+        line += ' ' + QByteArray::number(counter);
+    }
+    return line + '\n';
+}
+
+} // namespace
+
+void TestStorageMonitor::testIoRatesFromDiskStats()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString diskStats = dir.filePath("diskstats");
+    const QString mounts = dir.filePath("mounts");
+    QVERIFY(writeFile(mounts, "/dev/vdz1 " + QFile::encodeName(dir.path()) + " ext4 rw 0 0\n"));
+
+    // ram0 never did any I/O and is not listed
+    QVERIFY(writeFile(diskStats,
+        diskLine("vdz", 0, {100, 0, 800, 40, 50, 0, 400, 60, 0, 100, 100}) +
+        diskLine("ram0", 16, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0})));
+
+    StorageMonitor monitor;
+    monitor.setDiskStatsPath(diskStats);
+    monitor.setMountsPath(mounts);
+    monitor.setStoragePaths(QStringList() << dir.path());
+    monitor.setExternallyScheduled(true);
+    monitor.startMonitoring();
+
+    monitor.sample();
+    const StorageData first = monitor.getCurrentData();
+    QCOMPARE(first.blockDevices.size(), 1);
+    QCOMPARE(first.blockDevices.at(0).readSpeed, 0.0);
+
+    // Capacity of the mount holding the configured path
+    QCOMPARE(first.devices.size(), 1);
+    QCOMPARE(first.devices.at(0).path, dir.path());
+    QCOMPARE(first.devices.at(0).filesystem, QString("ext4"));
+    QVERIFY(first.devices.at(0).totalSpace > 0);
+    QVERIFY(first.devices.at(0).status != MetricStatus::Unknown);
+
+    // 200 reads, 100 writes, 20 ms busy, 60 ms of weighted queue time
+    QTest::qWait(100);
+    QVERIFY(writeFile(diskStats,
+        diskLine("vdz", 0, {300, 0, 2400, 90, 150, 0, 1200, 110, 3, 120, 160}) +
+        diskLine("ram0", 16, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0})));
+    monitor.sample();
+    const StorageData second = monitor.getCurrentData();
+    QCOMPARE(second.blockDevices.size(), 1);
+
+    // Rates over the real time between the two reads
+    const double intervalMs = (second.timestampNs - first.timestampNs) / 1e6;
+    const BlockDeviceData& disk = second.blockDevices.at(0);
+    QCOMPARE(disk.name, QString("vdz"));
+    QCOMPARE(disk.readSpeed, 1600 * 512.0 * 1000.0 / intervalMs);
+    QCOMPARE(disk.writeSpeed, 800 * 512.0 * 1000.0 / intervalMs);
+    QCOMPARE(disk.readIops, 200 * 1000.0 / intervalMs);
+    QCOMPARE(disk.writeIops, 100 * 1000.0 / intervalMs);
+    QCOMPARE(disk.serviceTime, 20.0 / 300);
+    QCOMPARE(disk.queueDepth, 60.0 / intervalMs);
+    QCOMPARE(disk.utilization, 20.0 * 100.0 / intervalMs);
+    QCOMPARE(disk.inFlight, 3);
+
+    QCOMPARE(second.totalReadSpeed, disk.readSpeed);
+    QCOMPARE(second.totalIops, disk.readIops + disk.writeIops);
+    QCOMPARE(second.peakUtilization, disk.utilization);
+    QCOMPARE(second.busiestDevice, QString("vdz"));
+    QVERIFY(monitor.getHistory().last().blockDevices.isEmpty());
+}
+
+void TestStorageMonitor::testMountResolution()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString mounts = dir.filePath("mounts");
+    const QByteArray dirPath = QFile::encodeName(dir.path());
+
+    // The directory is mounted twice, the later mount is on top
+    QVERIFY(writeFile(mounts,
+        "/dev/vdz2 / ext4 rw 0 0\n"
+        "/dev/vdz3 " + dirPath + " ext4 rw 0 0\n"
+        "tmpfs " + dirPath + " tmpfs rw 0 0\n"));
+
+    StorageMonitor monitor;
+    monitor.setDiskStatsPath(dir.filePath("diskstats"));
+    monitor.setMountsPath(mounts);
+    monitor.setStoragePaths(QStringList() << dir.filePath("sub") << dir.path() << "/");
+    monitor.setExternallyScheduled(true);
+    monitor.startMonitoring();
+    monitor.sample();
+
+    // Paths on one filesystem are reported once
+    const StorageData data = monitor.getCurrentData();
+    QCOMPARE(data.devices.size(), 2);
+    QCOMPARE(data.devices.at(0).path, dir.path());
+    QCOMPARE(data.devices.at(0).filesystem, QString("tmpfs"));
+    QCOMPARE(data.devices.at(1).path, QString("/"));
+    QCOMPARE(data.devices.at(1).filesystem, QString("ext4"));
+    QVERIFY(data.blockDevices.isEmpty());
+}
+
+void TestStorageMonitor::testCounterReset()
+{
+    if (!SystemInfoCache::is64BitKernel()) {
+        QSKIP("32-bit kernel: a decrease may be a genuine wrap");
+    }
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString diskStats = dir.filePath("diskstats");
+
+    // Counters between 2^31 and 2^32 before the disk is re-added
+    QVERIFY(writeFile(diskStats,
+        diskLine("vdz", 0, {3000000000ULL, 0, 4000000000ULL, 40, 3000000000ULL, 0,
+                            4000000000ULL, 60, 0, 100, 100})));
+
+    StorageMonitor monitor;
+    monitor.setDiskStatsPath(diskStats);
+    monitor.setMountsPath(dir.filePath("mounts"));
+    monitor.setStoragePaths(QStringList());
+    monitor.setExternallyScheduled(true);
+    monitor.startMonitoring();
+    monitor.sample();
+
+    // Starts over from small values: a reset, not a multi-GB burst
+    QTest::qWait(20);
+    QVERIFY(writeFile(diskStats,
+        diskLine("vdz", 0, {10, 0, 80, 1, 5, 0, 40, 1, 0, 2, 2})));
+    monitor.sample();
+    const StorageData data = monitor.getCurrentData();
+    QCOMPARE(data.blockDevices.size(), 1);
+    QCOMPARE(data.blockDevices.at(0).readSpeed, 0.0);
+    QCOMPARE(data.blockDevices.at(0).writeSpeed, 0.0);
+    QCOMPARE(data.totalIops, 0.0);
+}
+
+void TestStorageMonitor::testTimeCounterWrap()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString diskStats = dir.filePath("diskstats");
+
+    // The ms fields are %u in the kernel: 32 bits whatever the word size
+    QVERIFY(writeFile(diskStats,
+        diskLine("vdz", 0, {100, 0, 800, 40, 50, 0, 400, 60, 1, 4294967290ULL, 4294967000ULL})));
+
+    StorageMonitor monitor;
+    monitor.setDiskStatsPath(diskStats);
+    monitor.setMountsPath(dir.filePath("mounts"));
+    monitor.setStoragePaths(QStringList());
+    monitor.setExternallyScheduled(true);
+    monitor.startMonitoring();
+    monitor.sample();
+    const StorageData first = monitor.getCurrentData();
+
+    // 20 ms busy and 1000 ms of weighted queue time across the wrap
+    QTest::qWait(100);
+    QVERIFY(writeFile(diskStats,
+        diskLine("vdz", 0, {300, 0, 2400, 90, 150, 0, 1200, 110, 1, 14, 704})));
+    monitor.sample();
+    const StorageData second = monitor.getCurrentData();
+    QCOMPARE(second.blockDevices.size(), 1);
+
+    const double intervalMs = (second.timestampNs - first.timestampNs) / 1e6;
+    const BlockDeviceData& disk = second.blockDevices.at(0);
+    QCOMPARE(disk.serviceTime, 20.0 / 300);
+    QCOMPARE(disk.utilization, 20.0 * 100.0 / intervalMs);
+    QCOMPARE(disk.queueDepth, 1000.0 / intervalMs);
+}
@@ -0,0 +1,23 @@
+/**
+ * @file test_storagemonitor.h
+ * @brief StorageMonitor unit tests
+ */
+
+#ifndef TEST_STORAGEMONITOR_H
+#define TEST_STORAGEMONITOR_H
+
+#include <QObject>
+#include <QTest>
+
+class TestStorageMonitor : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testIoRatesFromDiskStats();
+    void testMountResolution();
+    void testCounterReset();
+    void testTimeCounterWrap();
+};
+
+#endif // TEST_STORAGEMONITOR_H
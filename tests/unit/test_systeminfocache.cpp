@@ -0,0 +1,67 @@
+/**
+ * @file test_systeminfocache.cpp
+ * @brief Test implementation for SystemInfoCache
+ */
+
+#include "test_systeminfocache.h"
+#include "core/systeminfocache.h"
+#include "core/systemutils.h"
+
+void TestSystemInfoCache::testMatchesUncached()
+{
+    SystemInfo cached = SystemInfoCache::info();
+    SystemInfo fresh = SystemInfoCache::collect();
+
+    QCOMPARE(cached.hostname, fresh.hostname);
+    QCOMPARE(cached.kernelVersion, fresh.kernelVersion);
+    QCOMPARE(cached.cpuModel, fresh.cpuModel);
+    QCOMPARE(cached.cpuCoreCount, fresh.cpuCoreCount);
+    QVERIFY(cached.cpuCoreCount > 0);
+    QVERIFY(cached.onlineCoreCount <= cached.cpuCoreCount);
+
+    // SystemUtils getters are served from the cache
+    QCOMPARE(SystemUtils::getCPUCoreCount(), cached.cpuCoreCount);
+    QCOMPARE(SystemUtils::getCPUModel(), cached.cpuModel);
+}
+
+void TestSystemInfoCache::testCountCPUList()
+{
+    QCOMPARE(SystemInfoCache::countCPUList("0"), 1);
+    QCOMPARE(SystemInfoCache::countCPUList("0-3\n"), 4);
+    QCOMPARE(SystemInfoCache::countCPUList("0-3,5,7-8"), 7);
+    QCOMPARE(SystemInfoCache::countCPUList(""), 0);
+    QCOMPARE(SystemInfoCache::countCPUList("3-1"), 0);
+}
+
+void TestSystemInfoCache::testWideArchitecture()
+{
+    QVERIFY(SystemInfoCache::isWideArchitecture("x86_64"));
+    QVERIFY(SystemInfoCache::isWideArchitecture("aarch64"));
+    QVERIFY(SystemInfoCache::isWideArchitecture("ppc64le"));
+    QVERIFY(SystemInfoCache::isWideArchitecture("s390x"));
+    QVERIFY(!SystemInfoCache::isWideArchitecture("armv7l"));
+    QVERIFY(!SystemInfoCache::isWideArchitecture("i686"));
+    QVERIFY(!SystemInfoCache::isWideArchitecture("Unknown"));
+}
+
+void TestSystemInfoCache::testGenerationStableWithoutHotplug()
+{
+    SystemInfoCache::checkHotplug();
+    const quint64 generation = SystemInfoCache::generation();
+
+    for (int i = 0; i < 100; ++i) {
+        QVERIFY(!SystemInfoCache::checkHotplug());
+    }
+    QCOMPARE(SystemInfoCache::generation(), generation);
+}
+
+void TestSystemInfoCache::testInvalidate()
+{
+    const quint64 generation = SystemInfoCache::generation();
+    const QString model = SystemInfoCache::cpuModel();
+
+    SystemInfoCache::invalidate();
+
+    QCOMPARE(SystemInfoCache::generation(), generation + 1);
+    QCOMPARE(SystemInfoCache::cpuModel(), model);
+}
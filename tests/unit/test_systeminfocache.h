@@ -0,0 +1,24 @@
+/**
+ * @file test_systeminfocache.h
+ * @brief Tests for the static system information cache
+ */
+
+#ifndef TEST_SYSTEMINFOCACHE_H
+#define TEST_SYSTEMINFOCACHE_H
+
+#include <QObject>
+#include <QTest>
+
+class TestSystemInfoCache : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testMatchesUncached();
+    void testCountCPUList();
+    void testWideArchitecture();
+    void testGenerationStableWithoutHotplug();
+    void testInvalidate();
+};
+
+#endif // TEST_SYSTEMINFOCACHE_H
@@ -0,0 +1,53 @@
+/**
+ * @file test_systemloadmonitor.cpp
+ * @brief SystemLoadMonitor unit tests implementation
+ *
+ * The monitor reads temporary files in /proc/loadavg and /proc/uptime
+ * format, rewritten in place between samples.
+ */
+
+#include "test_systemloadmonitor.h"
+#include "model/monitors/systemloadmonitor.h"
+#include "testhelpers.h"
+
+#include <QTemporaryDir>
+
+void TestSystemLoadMonitor::testLoadAndUptime()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString loadAvgPath = dir.filePath("loadavg");
+    const QString uptimePath = dir.filePath("uptime");
+    QVERIFY(writeFile(loadAvgPath, "0.50 0.25 0.10 2/140 4242\n"));
+    QVERIFY(writeFile(uptimePath, "3600.75 14000.10\n"));
+
+    SystemLoadMonitor monitor;
+    monitor.setProcPaths(loadAvgPath, uptimePath);
+    monitor.setExternallyScheduled(true);
+    monitor.startMonitoring();
+
+    monitor.sample();
+    const SystemData first = monitor.getCurrentData();
+    QVERIFY(first.isValid());
+    QCOMPARE(first.loadAverage1min, 0.50);
+    QCOMPARE(first.loadAverage15min, 0.10);
+    QCOMPARE(first.runningProcesses, 2);
+    QCOMPARE(first.processCount, 140);
+    QCOMPARE(first.uptime, qint64(3600));
+
+    // Boot time is fixed, only the load and uptime follow the files
+    QVERIFY(writeFile(loadAvgPath, "1.75 0.50 0.15 5/151 4300\n"));
+    QVERIFY(writeFile(uptimePath, "3605.80 14019.00\n"));
+    monitor.sample();
+    const SystemData second = monitor.getCurrentData();
+    QCOMPARE(second.loadAverage1min, 1.75);
+    QCOMPARE(second.processCount, 151);
+    QCOMPARE(second.uptime, qint64(3605));
+    QCOMPARE(second.bootTime, first.bootTime);
+    QCOMPARE(monitor.getHistory().size(), 2);
+
+    // A malformed file keeps the last good values
+    QVERIFY(writeFile(loadAvgPath, "garbage\n"));
+    monitor.sample();
+    QCOMPARE(monitor.getCurrentData().loadAverage1min, 1.75);
+}
@@ -0,0 +1,20 @@
+/**
+ * @file test_systemloadmonitor.h
+ * @brief SystemLoadMonitor unit tests
+ */
+
+#ifndef TEST_SYSTEMLOADMONITOR_H
+#define TEST_SYSTEMLOADMONITOR_H
+
+#include <QObject>
+#include <QTest>
+
+class TestSystemLoadMonitor : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testLoadAndUptime();
+};
+
+#endif // TEST_SYSTEMLOADMONITOR_H
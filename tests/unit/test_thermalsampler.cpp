@@ -0,0 +1,149 @@
+/**
+ * @file test_thermalsampler.cpp
+ * @brief ThermalSampler unit tests implementation
+ *
+ * The sampler discovers a temporary sysfs tree: thermal zones, hwmon
+ * inputs and the CPU topology, rewritten in place between samples.
+ */
+
+#include "test_thermalsampler.h"
+#include "core/thermalsampler.h"
+#include "testhelpers.h"
+
+#include <QDir>
+#include <QFileInfo>
+#include <QTemporaryDir>
+
+namespace {
+
+bool writeSysfs(const QString& root, const QString& path, const QByteArray& content)
+{
+    const QString filePath = root + "/" + path;
+    return QDir().mkpath(QFileInfo(filePath).absolutePath()) && writeFile(filePath, content);
+}
+
+bool writeTopology(const QString& cpuRoot, int cpu, int packageId, int coreId)
+{
+    const QString topology = QString("cpu%1/topology/").arg(cpu);
+    return writeSysfs(cpuRoot, topology + "physical_package_id", QByteArray::number(packageId) + "\n") &&
+           writeSysfs(cpuRoot, topology + "core_id", QByteArray::number(coreId) + "\n");
+}
+
+} // namespace
+
+void TestThermalSampler::testCPUSensorName()
+{
+    QVERIFY(ThermalSampler::isCPUSensorName("x86_pkg_temp"));
+    QVERIFY(ThermalSampler::isCPUSensorName("coretemp"));
+    QVERIFY(ThermalSampler::isCPUSensorName("k10temp"));
+    QVERIFY(ThermalSampler::isCPUSensorName("cpu-thermal"));
+    QVERIFY(ThermalSampler::isCPUSensorName("cpu1-thermal"));
+    QVERIFY(!ThermalSampler::isCPUSensorName("acpitz"));
+    QVERIFY(!ThermalSampler::isCPUSensorName("nvme"));
+    QVERIFY(!ThermalSampler::isCPUSensorName("iwlwifi_1"));
+}
+
+void TestThermalSampler::testDiscovery()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString thermalRoot = dir.filePath("thermal");
+    const QString hwmonRoot = dir.filePath("hwmon");
+
+    // zone0 is ACPI and the hottest sensor; zone10 sorts after zone2
+    QVERIFY(writeSysfs(thermalRoot, "thermal_zone0/type", "acpitz\n"));
+    QVERIFY(writeSysfs(thermalRoot, "thermal_zone0/temp", "90000\n"));
+    QVERIFY(writeSysfs(thermalRoot, "thermal_zone2/type", "iwlwifi_1\n"));
+    QVERIFY(writeSysfs(thermalRoot, "thermal_zone2/temp", "40000\n"));
+    QVERIFY(writeSysfs(thermalRoot, "thermal_zone10/type", "x86_pkg_temp\n"));
+    QVERIFY(writeSysfs(thermalRoot, "thermal_zone10/temp", "55000\n"));
+
+    // Unlabelled input keeps its sensor name
+    QVERIFY(writeSysfs(hwmonRoot, "hwmon1/name", "nvme\n"));
+    QVERIFY(writeSysfs(hwmonRoot, "hwmon1/temp1_input", "38850\n"));
+    QVERIFY(writeSysfs(hwmonRoot, "hwmon3/name", "coretemp\n"));
+    QVERIFY(writeSysfs(hwmonRoot, "hwmon3/temp1_label", "Package id 0\n"));
+    QVERIFY(writeSysfs(hwmonRoot, "hwmon3/temp1_input", "56000\n"));
+    QVERIFY(writeSysfs(hwmonRoot, "hwmon3/temp2_label", "Core 0\n"));
+    QVERIFY(writeSysfs(hwmonRoot, "hwmon3/temp2_input", "61000\n"));
+
+    ThermalSampler sampler;
+    QCOMPARE(sampler.discover(thermalRoot, hwmonRoot, dir.filePath("cpu")), 6);
+    QCOMPARE(sampler.sample(), 6);
+
+    const QVector<ThermalZoneData>& zones = sampler.zones();
+    QCOMPARE(zones.at(0).label, QString("acpitz"));
+    QCOMPARE(zones.at(1).label, QString("iwlwifi_1"));
+    QCOMPARE(zones.at(2).label, QString("x86_pkg_temp"));
+    QCOMPARE(zones.at(3).label, QString("nvme temp1"));
+    QCOMPARE(zones.at(4).label, QString("coretemp Package id 0"));
+    QCOMPARE(zones.at(5).label, QString("coretemp Core 0"));
+    QVERIFY(!zones.at(0).isCPUSensor);
+    QVERIFY(!zones.at(3).isCPUSensor);
+    QVERIFY(zones.at(2).isCPUSensor);
+    QVERIFY(zones.at(5).isCPUSensor);
+    QCOMPARE(zones.at(3).temperature, 38.85);
+    QCOMPARE(zones.at(0).status, MetricStatus::Critical);
+    QCOMPARE(zones.at(3).status, MetricStatus::Normal);
+
+    // The package sensor, not zone0; the hottest CPU sensor, not ACPI
+    QCOMPARE(sampler.cpuTemperature(), 55.0);
+    QCOMPARE(sampler.maxTemperature(), 61.0);
+
+    // An unreadable value drops out of the results
+    QVERIFY(writeSysfs(thermalRoot, "thermal_zone10/temp", "garbage\n"));
+    QCOMPARE(sampler.sample(), 5);
+    QCOMPARE(sampler.zones().at(2).status, MetricStatus::Unknown);
+    QCOMPARE(sampler.cpuTemperature(), 0.0);
+}
+
+void TestThermalSampler::testCoreTemperatures()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString hwmonRoot = dir.filePath("hwmon");
+    const QString cpuRoot = dir.filePath("cpu");
+
+    // Core ids are not dense: "Core 4" is the second physical core
+    QVERIFY(writeSysfs(hwmonRoot, "hwmon0/name", "coretemp\n"));
+    QVERIFY(writeSysfs(hwmonRoot, "hwmon0/temp1_label", "Package id 0\n"));
+    QVERIFY(writeSysfs(hwmonRoot, "hwmon0/temp1_input", "50000\n"));
+    QVERIFY(writeSysfs(hwmonRoot, "hwmon0/temp2_label", "Core 0\n"));
+    QVERIFY(writeSysfs(hwmonRoot, "hwmon0/temp2_input", "45000\n"));
+    QVERIFY(writeSysfs(hwmonRoot, "hwmon0/temp6_label", "Core 4\n"));
+    QVERIFY(writeSysfs(hwmonRoot, "hwmon0/temp6_input", "47000\n"));
+
+    // cpu2 is the SMT sibling of cpu0, cpu3 has no sensor, cpu4 is offline
+    QVERIFY(writeTopology(cpuRoot, 0, 0, 0));
+    QVERIFY(writeTopology(cpuRoot, 1, 0, 4));
+    QVERIFY(writeTopology(cpuRoot, 2, 0, 0));
+    QVERIFY(writeTopology(cpuRoot, 3, 0, 8));
+    QVERIFY(QDir().mkpath(cpuRoot + "/cpu4"));
+    QVERIFY(QDir().mkpath(cpuRoot + "/cpufreq"));
+    QVERIFY(QDir().mkpath(cpuRoot + "/cpuidle"));
+
+    ThermalSampler sampler;
+    QCOMPARE(sampler.discover(dir.filePath("thermal"), hwmonRoot, cpuRoot), 3);
+    QCOMPARE(sampler.sample(), 3);
+    QCOMPARE(sampler.cpuTemperature(), 50.0);
+    QCOMPARE(sampler.coreTemperatures(), QVector<double>({45.0, 47.0, 45.0, 50.0, 50.0}));
+
+    // A core whose sensor stops reading falls back to the package
+    QVERIFY(writeSysfs(hwmonRoot, "hwmon0/temp6_input", "garbage\n"));
+    QCOMPARE(sampler.sample(), 2);
+    QCOMPARE(sampler.coreTemperatures(), QVector<double>({45.0, 50.0, 45.0, 50.0, 50.0}));
+}
+
+void TestThermalSampler::testMissingRoots()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    ThermalSampler sampler;
+    QCOMPARE(sampler.discover(dir.filePath("thermal"), dir.filePath("hwmon"), dir.filePath("cpu")), 0);
+    QCOMPARE(sampler.sample(), 0);
+    QVERIFY(sampler.zones().isEmpty());
+    QVERIFY(sampler.coreTemperatures().isEmpty());
+    QCOMPARE(sampler.cpuTemperature(), 0.0);
+    QCOMPARE(sampler.maxTemperature(), 0.0);
+}
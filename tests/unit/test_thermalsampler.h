@@ -0,0 +1,23 @@
+/**
+ * @file test_thermalsampler.h
+ * @brief ThermalSampler unit tests
+ */
+
+#ifndef TEST_THERMALSAMPLER_H
+#define TEST_THERMALSAMPLER_H
+
+#include <QObject>
+#include <QTest>
+
+class TestThermalSampler : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testCPUSensorName();
+    void testDiscovery();
+    void testCoreTemperatures();
+    void testMissingRoots();
+};
+
+#endif // TEST_THERMALSAMPLER_H
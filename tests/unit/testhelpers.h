@@ -0,0 +1,24 @@
+/**
+ * @file testhelpers.h
+ * @brief Helpers shared by the unit tests
+ */
+
+#ifndef TESTHELPERS_H
+#define TESTHELPERS_H
+
+#include <QByteArray>
+#include <QFile>
+#include <QString>
+
+/**
+ * @brief Replace a fixture file's content (proc/sysfs stand-ins)
+ * Truncates, so a shorter rewrite leaves no stale tail.
+ */
+inline bool writeFile(const QString& path, const QByteArray& content)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) return false;
+    return file.write(content) == content.size();
+}
+
+#endif // TESTHELPERS_H